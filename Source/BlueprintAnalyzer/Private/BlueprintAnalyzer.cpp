@@ -7,12 +7,19 @@
 
 void FBlueprintAnalyzerModule::StartupModule()
 {
-	FBlueprintAnalyzerMenuExtension::Initialize();
+	// Menus need Slate; headless runs (UBlueprintAnalyzerCommandlet, -nullrhi) skip them
+	if (!IsRunningCommandlet())
+	{
+		FBlueprintAnalyzerMenuExtension::Initialize();
+	}
 }
 
 void FBlueprintAnalyzerModule::ShutdownModule()
 {
-	FBlueprintAnalyzerMenuExtension::Shutdown();
+	if (!IsRunningCommandlet())
+	{
+		FBlueprintAnalyzerMenuExtension::Shutdown();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
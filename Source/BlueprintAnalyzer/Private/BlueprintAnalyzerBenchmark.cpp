@@ -0,0 +1,151 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerBenchmark.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerPipeline.h"
+#include "BlueprintAnalyzerSnapshot.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/Blueprint.h"
+#include "WidgetBlueprint.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "UObject/UObjectGlobals.h"
+
+static double MedianOf(TArray<double> Values)
+{
+    Values.Sort();
+    return Values[Values.Num() / 2];
+}
+
+bool FBPBenchmark::Run(const TArray<int32>& Sizes, const FBPSyntheticShape& BaseShape, int32 Iterations, TArray<FBPBenchmarkSample>& OutSamples)
+{
+    check(IsInGameThread());
+
+    Iterations = FMath::Max(Iterations, 1);
+
+    for (const int32 NodeCount : Sizes)
+    {
+        FBPSyntheticShape Shape = BaseShape;
+        Shape.NodeCount = NodeCount;
+        Shape.WidgetCount = NodeCount;
+
+        const double GenerateStartTime = FPlatformTime::Seconds();
+        UBlueprint* Blueprint = FBPSyntheticBlueprints::CreateActorBlueprint(FString::Printf(TEXT("BP_Benchmark_%d"), NodeCount), Shape);
+        UWidgetBlueprint* WidgetBlueprint = FBPSyntheticBlueprints::CreateWidgetBlueprint(FString::Printf(TEXT("WBP_Benchmark_%d"), NodeCount), Shape);
+        if (!Blueprint || !WidgetBlueprint)
+        {
+            UE_LOG(LogTemp, Error, TEXT("BlueprintAnalyzer: failed to generate benchmark Blueprints with %d nodes"), NodeCount);
+            return false;
+        }
+        UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: generated %d nodes in %.3f s"), NodeCount, FPlatformTime::Seconds() - GenerateStartTime);
+
+        // Inputs for the exporters, produced outside the timed region
+        const FBlueprintAnalysisResult Analysis = UBlueprintAnalyzerLibrary::AnalyzeBlueprint(Blueprint);
+        const FBPPerformanceReport PerformanceReport = UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(Blueprint);
+        const FWidgetOptimizationReport WidgetReport = UBlueprintAnalyzerLibrary::AnalyzeWidgetBlueprint(WidgetBlueprint);
+        const TArray<FAssetData> FolderAssets = { FAssetData(Blueprint) };
+
+        FBPFolderAnalysisOptions FolderOptions;
+        FolderOptions.bUseCache = false;
+        FolderOptions.PrefetchWindow = 0;
+
+        const TArray<TPair<FString, TFunction<void()>>> Operations =
+        {
+            { TEXT("Capture"), [Blueprint]() { FBPSnapshotAnalyzer::Capture(Blueprint); } },
+            { TEXT("AnalyzeBlueprint"), [Blueprint]() { UBlueprintAnalyzerLibrary::AnalyzeBlueprint(Blueprint); } },
+            { TEXT("TraceExecutionPaths"), [Blueprint]()
+                {
+                    TArray<FExecutionPath> Paths;
+                    TArray<FExecutionPath> SharedSegments;
+                    FBPSnapshotAnalyzer::TraceExecutionPaths(FBPSnapshotAnalyzer::Capture(Blueprint), Paths, SharedSegments);
+                } },
+            { TEXT("AnalyzeBlueprintPerformance"), [Blueprint]() { UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(Blueprint); } },
+            { TEXT("AnalyzeWidgetBlueprint"), [WidgetBlueprint]() { UBlueprintAnalyzerLibrary::AnalyzeWidgetBlueprint(WidgetBlueprint); } },
+            { TEXT("ExportToJSON"), [&Analysis]() { UBlueprintAnalyzerLibrary::ExportToJSON(Analysis); } },
+            { TEXT("ExportToLLMText"), [&Analysis]() { UBlueprintAnalyzerLibrary::ExportToLLMText(Analysis); } },
+            { TEXT("ExportPerformanceReportToJSON"), [&PerformanceReport]() { UBlueprintAnalyzerLibrary::ExportPerformanceReportToJSON(PerformanceReport); } },
+            { TEXT("ExportPerformanceReportToLLMText"), [&PerformanceReport]() { UBlueprintAnalyzerLibrary::ExportPerformanceReportToLLMText(PerformanceReport); } },
+            { TEXT("ExportWidgetAnalysisToJSON"), [&WidgetReport]() { UBlueprintAnalyzerLibrary::ExportWidgetAnalysisToJSON(WidgetReport); } },
+            { TEXT("ExportWidgetAnalysisToLLMText"), [&WidgetReport]() { UBlueprintAnalyzerLibrary::ExportWidgetAnalysisToLLMText(WidgetReport); } },
+            { TEXT("AnalyzeFolder"), [&FolderAssets, &FolderOptions]()
+                {
+                    FBPAnalysisPipeline Pipeline(TEXT("/Temp/BlueprintAnalyzer"), FolderAssets, FolderOptions);
+                    while (Pipeline.Step())
+                    {
+                    }
+                    Pipeline.Finish();
+                } },
+        };
+
+        for (const TPair<FString, TFunction<void()>>& Operation : Operations)
+        {
+            TArray<double> Times;
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                const double StartTime = FPlatformTime::Seconds();
+                Operation.Value();
+                Times.Add(FPlatformTime::Seconds() - StartTime);
+            }
+
+            FBPBenchmarkSample& Sample = OutSamples.AddDefaulted_GetRef();
+            Sample.Operation = Operation.Key;
+            Sample.NodeCount = NodeCount;
+            Sample.MedianSeconds = MedianOf(Times);
+            Sample.MinSeconds = FMath::Min(Times);
+
+            UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: [bench] %-34s %6d nodes %10.3f ms"), *Sample.Operation, NodeCount, Sample.MedianSeconds * 1000.0);
+        }
+
+        FBPSyntheticBlueprints::Discard(Blueprint);
+        FBPSyntheticBlueprints::Discard(WidgetBlueprint);
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+    }
+
+    return true;
+}
+
+TArray<FString> FBPBenchmark::FindSuperlinearScaling(const TArray<FBPBenchmarkSample>& Samples, double MaxExponent, int32 MinFitNodes)
+{
+    TMap<FString, TArray<const FBPBenchmarkSample*>> ByOperation;
+    for (const FBPBenchmarkSample& Sample : Samples)
+    {
+        ByOperation.FindOrAdd(Sample.Operation).Add(&Sample);
+    }
+
+    TArray<FString> Failures;
+    for (const TPair<FString, TArray<const FBPBenchmarkSample*>>& Pair : ByOperation)
+    {
+        const FBPBenchmarkSample* Previous = nullptr;
+        for (const FBPBenchmarkSample* Sample : Pair.Value)
+        {
+            if (Sample->NodeCount < MinFitNodes || Sample->MedianSeconds < MinScalingSeconds) continue;
+
+            if (Previous)
+            {
+                const double Exponent = FMath::Loge(Sample->MedianSeconds / Previous->MedianSeconds)
+                    / FMath::Loge(double(Sample->NodeCount) / double(Previous->NodeCount));
+                if (Exponent > MaxExponent)
+                {
+                    Failures.Add(FString::Printf(TEXT("%s scales superlinearly between %d and %d nodes (exponent %.2f > %.2f)"),
+                        *Pair.Key, Previous->NodeCount, Sample->NodeCount, Exponent, MaxExponent));
+                }
+            }
+            Previous = Sample;
+        }
+    }
+    return Failures;
+}
+
+bool FBPBenchmark::WriteCsv(const TArray<FBPBenchmarkSample>& Samples, const FString& FilePath)
+{
+    FString Csv = TEXT("Operation,Nodes,MedianSeconds,MinSeconds,MicrosecondsPerNode\n");
+    for (const FBPBenchmarkSample& Sample : Samples)
+    {
+        Csv += FString::Printf(TEXT("%s,%d,%.6f,%.6f,%.4f\n"), *Sample.Operation, Sample.NodeCount,
+            Sample.MedianSeconds, Sample.MinSeconds, Sample.MedianSeconds * 1e6 / Sample.NodeCount);
+    }
+
+    const bool bOk = FFileHelper::SaveStringToFile(Csv, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: %s %s"), bOk ? TEXT("wrote") : TEXT("FAILED to write"), *FilePath);
+    return bOk;
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerBenchmarkCommandlet.h"
+#include "BlueprintAnalyzerBenchmark.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+UBlueprintAnalyzerBenchmarkCommandlet::UBlueprintAnalyzerBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UBlueprintAnalyzerBenchmarkCommandlet::Main(const FString& Params)
+{
+    TArray<int32> Sizes;
+    {
+        FString SizesValue = TEXT("10+100+1000+10000+50000");
+        FParse::Value(*Params, TEXT("Sizes="), SizesValue, false);
+
+        TArray<FString> Items;
+        static const TCHAR* Delimiters[] = { TEXT("+"), TEXT(",") };
+        SizesValue.ParseIntoArray(Items, Delimiters, UE_ARRAY_COUNT(Delimiters), true);
+        for (const FString& Item : Items)
+        {
+            const int32 Size = FCString::Atoi(*Item);
+            if (Size > 0)
+            {
+                Sizes.Add(Size);
+            }
+        }
+        Sizes.Sort();
+    }
+    if (Sizes.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("BlueprintAnalyzer: no valid -Sizes= given"));
+        return 1;
+    }
+
+    int32 Iterations = 3;
+    double MaxExponent = 1.3;
+    int32 MinFitNodes = 1000;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    FParse::Value(*Params, TEXT("MaxExponent="), MaxExponent);
+    FParse::Value(*Params, TEXT("MinFitNodes="), MinFitNodes);
+
+    FBPSyntheticShape BaseShape;
+    FParse::Value(*Params, TEXT("BranchEvery="), BaseShape.BranchEvery);
+    FParse::Value(*Params, TEXT("FanOut="), BaseShape.FanOut);
+    FParse::Value(*Params, TEXT("CommentsPer100="), BaseShape.CommentsPer100Nodes);
+    FParse::Value(*Params, TEXT("Functions="), BaseShape.FunctionCount);
+    FParse::Value(*Params, TEXT("WidgetDepth="), BaseShape.WidgetDepth);
+
+    FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintAnalyzer"), TEXT("Benchmark.csv"));
+    FParse::Value(*Params, TEXT("Output="), OutputPath, false);
+    OutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
+
+    TArray<FBPBenchmarkSample> Samples;
+    if (!FBPBenchmark::Run(Sizes, BaseShape, Iterations, Samples))
+    {
+        return 1;
+    }
+
+    bool bOk = FBPBenchmark::WriteCsv(Samples, OutputPath);
+
+    for (const FString& Failure : FBPBenchmark::FindSuperlinearScaling(Samples, MaxExponent, MinFitNodes))
+    {
+        UE_LOG(LogTemp, Error, TEXT("BlueprintAnalyzer: %s"), *Failure);
+        bOk = false;
+    }
+
+    return bOk ? 0 : 1;
+}
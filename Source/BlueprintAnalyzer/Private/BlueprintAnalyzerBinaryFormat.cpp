@@ -0,0 +1,441 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerBinaryFormat.h"
+#include "BlueprintAnalyzerProfiling.h"
+#include "BlueprintAnalyzerStringKeyFuncs.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/FileHelper.h"
+
+// String table entry header for a GUID stored as 16 raw bytes instead of 32 hex characters
+static constexpr uint32 GuidStringHeader = 1;
+
+// ============================================================
+// FBPBinaryArchive
+// Wraps the body archive and maps strings to table indices; the struct
+// operators below are used for both saving and loading, like the cache's.
+// ============================================================
+
+class FBPBinaryArchive
+{
+public:
+    explicit FBPBinaryArchive(FArchive& InInner)
+        : Inner(InInner)
+    {
+    }
+
+    bool IsLoading() const { return Inner.IsLoading(); }
+    bool IsError() const { return Inner.IsError(); }
+
+    // Version of the file being read; always the current version when saving
+    uint16 Version = FBPBinaryFormat::FormatVersion;
+
+    // Filled while saving; provided up front when loading
+    TArray<FString> Strings;
+
+    FBPBinaryArchive& operator<<(FString& Value)
+    {
+        uint32 Index = 0;
+        if (IsLoading())
+        {
+            Inner.SerializeIntPacked(Index);
+            if (!Strings.IsValidIndex(static_cast<int32>(Index)))
+            {
+                Inner.SetError();
+                Value.Reset();
+                return *this;
+            }
+            Value = Strings[Index];
+        }
+        else
+        {
+            if (const uint32* Existing = StringIndices.Find(Value))
+            {
+                Index = *Existing;
+            }
+            else
+            {
+                Index = Strings.Add(Value);
+                StringIndices.Add(Value, Index);
+            }
+            Inner.SerializeIntPacked(Index);
+        }
+        return *this;
+    }
+
+    FBPBinaryArchive& operator<<(int32& Value)
+    {
+        uint32 Encoded = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+        Inner.SerializeIntPacked(Encoded);
+        Value = static_cast<int32>(Encoded >> 1) ^ -static_cast<int32>(Encoded & 1);
+        return *this;
+    }
+
+    FBPBinaryArchive& operator<<(int64& Value)
+    {
+        uint64 Encoded = (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+        Inner.SerializeIntPacked64(Encoded);
+        Value = static_cast<int64>(Encoded >> 1) ^ -static_cast<int64>(Encoded & 1);
+        return *this;
+    }
+
+    FBPBinaryArchive& operator<<(float& Value)
+    {
+        Inner << Value;
+        return *this;
+    }
+
+    FBPBinaryArchive& operator<<(bool& Value)
+    {
+        uint8 Byte = Value ? 1 : 0;
+        Inner << Byte;
+        Value = Byte != 0;
+        return *this;
+    }
+
+    template<typename ElementType>
+    FBPBinaryArchive& operator<<(TArray<ElementType>& Array)
+    {
+        uint32 Num = static_cast<uint32>(Array.Num());
+        Inner.SerializeIntPacked(Num);
+
+        if (IsLoading())
+        {
+            // Every element takes at least one byte, so a larger count can only be corrupt data
+            if (Num > static_cast<uint64>(Inner.TotalSize() - Inner.Tell()))
+            {
+                Inner.SetError();
+                return *this;
+            }
+            Array.SetNum(static_cast<int32>(Num));
+        }
+
+        for (ElementType& Element : Array)
+        {
+            *this << Element;
+            if (IsError()) break;
+        }
+        return *this;
+    }
+
+private:
+    FArchive& Inner;
+    TMap<FString, uint32, FDefaultSetAllocator, TBPCaseSensitiveKeyFuncs<uint32>> StringIndices;
+};
+
+// ============================================================
+// Struct layouts
+// Fields added after FormatVersion 1 are read only from files of their version.
+// ============================================================
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBlueprintNodeInfo& Node)
+{
+    return Ar << Node.NodeType << Node.NodeName << Node.FunctionName << Node.InputPins << Node.OutputPins
+        << Node.NodeGuid << Node.GraphName << Node.LiteralValues << Node.CommentGroup;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBlueprintConnectionInfo& Connection)
+{
+    return Ar << Connection.FromNodeGuid << Connection.FromPinName << Connection.ToNodeGuid << Connection.ToPinName;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPVariableInfo& Variable)
+{
+    return Ar << Variable.VariableName << Variable.VariableType << Variable.DefaultValue << Variable.Category << Variable.Tooltip
+        << Variable.bEditable << Variable.bReplicated << Variable.bExposeOnSpawn;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPFunctionParam& Param)
+{
+    return Ar << Param.ParamName << Param.ParamType << Param.bIsReference << Param.bIsConst << Param.bIsReturn;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPFunctionSignature& Function)
+{
+    return Ar << Function.FunctionName << Function.Parameters << Function.ReturnType << Function.AccessSpecifier << Function.Category
+        << Function.bPure << Function.bStatic << Function.bConst;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPComponentInfo& Component)
+{
+    return Ar << Component.ComponentName << Component.ComponentType << Component.ParentComponentName << Component.AttachSocketName;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPEventDispatcherInfo& Dispatcher)
+{
+    return Ar << Dispatcher.DispatcherName << Dispatcher.Parameters;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPAnalyzerMetadata& Metadata)
+{
+    return Ar << Metadata.BlueprintType << Metadata.ParentClass << Metadata.ImplementedInterfaces << Metadata.Variables
+        << Metadata.CustomFunctions << Metadata.Components << Metadata.EventDispatchers << Metadata.MacroNames << Metadata.TimelineNames;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FExecutionStep& Step)
+{
+    Ar << Step.NodeGuid << Step.NodeType << Step.Summary << Step.BranchLabel << Step.Depth << Step.bIsTerminator << Step.bIsLatent;
+    if (Ar.Version >= 2)
+    {
+        Ar << Step.bIsTruncated;
+    }
+    if (Ar.Version >= 3)
+    {
+        Ar << Step.bIsSharedSegment;
+    }
+    if (Ar.Version >= 4)
+    {
+        Ar << Step.CallDepth << Step.bIsRecursiveCall;
+    }
+    return Ar;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FExecutionPath& Path)
+{
+    Ar << Path.EntryPointName << Path.EntryNodeGuid << Path.GraphName << Path.Steps;
+    if (Ar.Version >= 2)
+    {
+        Ar << Path.bTruncated;
+    }
+    return Ar;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBlueprintAnalysisResult& Result)
+{
+    Ar << Result.BlueprintName << Result.AnalysisTimestamp << Result.Metadata << Result.Nodes << Result.Connections << Result.ExecutionPaths;
+    if (Ar.Version >= 3)
+    {
+        Ar << Result.SharedSegments;
+    }
+    return Ar;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPBlueprintSummary& Summary)
+{
+    Ar << Summary.BlueprintName << Summary.BlueprintPath << Summary.BlueprintType << Summary.NodeCount << Summary.PerformanceScore
+        << Summary.CriticalIssues << Summary.EstimatedTokenCount << Summary.ParentClass << Summary.ImplementedInterfaces
+        << Summary.PackageDiskSize << Summary.HardDependencyCount << Summary.SoftDependencyCount << Summary.ReferencerCount << Summary.bQuickScan;
+    if (Ar.Version >= 5)
+    {
+        Ar << Summary.EstimatedTickCost;
+    }
+    return Ar;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPDependency& Dependency)
+{
+    return Ar << Dependency.ReferencingBlueprint << Dependency.ReferencedClass << Dependency.ReferenceType << Dependency.NodeGuid << Dependency.GraphName;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPDependencyCycle& Cycle)
+{
+    return Ar << Cycle.Members << Cycle.RepresentativeCycle;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPStageTiming& Timing)
+{
+    return Ar << Timing.Stage << Timing.Calls << Timing.WallSeconds << Timing.PeakUsedPhysicalBytes;
+}
+
+static FBPBinaryArchive& operator<<(FBPBinaryArchive& Ar, FBPProjectAnalysis& Analysis)
+{
+    return Ar << Analysis.FolderPath << Analysis.AnalysisTimestamp << Analysis.BlueprintsAnalyzed << Analysis.TotalNodes
+        << Analysis.AveragePerformanceScore << Analysis.bQuickScan << Analysis.Summaries << Analysis.Dependencies
+        << Analysis.CircularDependencyChains << Analysis.DependencyCycles << Analysis.PeakWorkingSetBytes << Analysis.ChunkCollections
+        << Analysis.PrefetchedPackages << Analysis.LoadStalls << Analysis.LoadStallSeconds << Analysis.StageTimings;
+}
+
+// ============================================================
+// Container: header + string table + body
+// ============================================================
+
+static bool IsCanonicalGuidString(const FString& Value, FGuid& OutGuid)
+{
+    return Value.Len() == 32
+        && FGuid::ParseExact(Value, EGuidFormats::Digits, OutGuid)
+        && OutGuid.ToString(EGuidFormats::Digits).Equals(Value, ESearchCase::CaseSensitive);
+}
+
+template<typename PayloadType>
+static TArray<uint8> WritePayload(EBPBinaryPayload PayloadKind, const PayloadType& Payload)
+{
+    BPA_STAGE_SCOPE(ExportBinary);
+
+    // Body first: the string table is only complete once every field has been written
+    TArray<uint8> Body;
+    FMemoryWriter BodyWriter(Body);
+    FBPBinaryArchive Ar(BodyWriter);
+    Ar << const_cast<PayloadType&>(Payload);
+
+    TArray<uint8> Out;
+    FMemoryWriter Writer(Out);
+
+    uint32 Magic = FBPBinaryFormat::Magic;
+    uint16 Version = FBPBinaryFormat::FormatVersion;
+    uint8 Kind = static_cast<uint8>(PayloadKind);
+    uint8 Reserved = 0;
+    Writer << Magic << Version << Kind << Reserved;
+
+    uint32 NumStrings = static_cast<uint32>(Ar.Strings.Num());
+    Writer.SerializeIntPacked(NumStrings);
+    for (const FString& String : Ar.Strings)
+    {
+        FGuid Guid;
+        if (IsCanonicalGuidString(String, Guid))
+        {
+            uint32 Header = GuidStringHeader;
+            Writer.SerializeIntPacked(Header);
+            Writer << Guid;
+        }
+        else
+        {
+            FTCHARToUTF8 Utf8(*String, String.Len());
+            uint32 Header = static_cast<uint32>(Utf8.Length()) << 1;
+            Writer.SerializeIntPacked(Header);
+            Writer.Serialize((void*)Utf8.Get(), Utf8.Length());
+        }
+    }
+
+    Out.Append(Body);
+    return Out;
+}
+
+template<typename PayloadType>
+static bool ReadPayload(TConstArrayView<uint8> Bytes, EBPBinaryPayload PayloadKind, PayloadType& OutPayload)
+{
+    FMemoryReaderView Reader(Bytes);
+
+    uint32 Magic = 0;
+    uint16 Version = 0;
+    uint8 Kind = 0;
+    uint8 Reserved = 0;
+    Reader << Magic << Version << Kind << Reserved;
+
+    if (Reader.IsError() || Magic != FBPBinaryFormat::Magic)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: not a BlueprintAnalyzer binary file"));
+        return false;
+    }
+    if (Version > FBPBinaryFormat::FormatVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: binary file version %d is newer than supported version %d"), Version, FBPBinaryFormat::FormatVersion);
+        return false;
+    }
+    if (Kind != static_cast<uint8>(PayloadKind))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: binary file holds a different result type (%d, expected %d)"), Kind, static_cast<uint8>(PayloadKind));
+        return false;
+    }
+
+    FBPBinaryArchive Ar(Reader);
+    Ar.Version = Version;
+
+    uint32 NumStrings = 0;
+    Reader.SerializeIntPacked(NumStrings);
+    if (NumStrings > static_cast<uint64>(Reader.TotalSize() - Reader.Tell()))
+    {
+        Reader.SetError();
+    }
+    else
+    {
+        Ar.Strings.Reserve(static_cast<int32>(NumStrings));
+    }
+
+    TArray<UTF8CHAR> Utf8;
+    for (uint32 StringIndex = 0; StringIndex < NumStrings && !Reader.IsError(); ++StringIndex)
+    {
+        uint32 Header = 0;
+        Reader.SerializeIntPacked(Header);
+
+        if (Header == GuidStringHeader)
+        {
+            FGuid Guid;
+            Reader << Guid;
+            Ar.Strings.Add(Guid.ToString(EGuidFormats::Digits));
+            continue;
+        }
+
+        const uint32 Length = Header >> 1;
+        if ((Header & 1) != 0 || Length > static_cast<uint64>(Reader.TotalSize() - Reader.Tell()))
+        {
+            Reader.SetError();
+            break;
+        }
+        Utf8.SetNumUninitialized(static_cast<int32>(Length));
+        Reader.Serialize(Utf8.GetData(), Length);
+
+        FUTF8ToTCHAR Converted(Utf8.GetData(), static_cast<int32>(Length));
+        Ar.Strings.Emplace(Converted.Length(), Converted.Get());
+    }
+
+    if (!Reader.IsError())
+    {
+        Ar << OutPayload;
+    }
+
+    if (Reader.IsError() || Reader.Tell() != Reader.TotalSize())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: binary file is truncated or corrupt"));
+        OutPayload = PayloadType();
+        return false;
+    }
+    return true;
+}
+
+// ============================================================
+// FBPBinaryFormat
+// ============================================================
+
+TArray<uint8> FBPBinaryFormat::Write(const FBlueprintAnalysisResult& Result)
+{
+    return WritePayload(EBPBinaryPayload::AnalysisResult, Result);
+}
+
+TArray<uint8> FBPBinaryFormat::Write(const FBPProjectAnalysis& Analysis)
+{
+    return WritePayload(EBPBinaryPayload::ProjectAnalysis, Analysis);
+}
+
+bool FBPBinaryFormat::Read(TConstArrayView<uint8> Bytes, FBlueprintAnalysisResult& OutResult)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FBPBinaryFormat::Read);
+    return ReadPayload(Bytes, EBPBinaryPayload::AnalysisResult, OutResult);
+}
+
+bool FBPBinaryFormat::Read(TConstArrayView<uint8> Bytes, FBPProjectAnalysis& OutAnalysis)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FBPBinaryFormat::Read);
+    return ReadPayload(Bytes, EBPBinaryPayload::ProjectAnalysis, OutAnalysis);
+}
+
+bool FBPBinaryFormat::SaveToFile(const FBlueprintAnalysisResult& Result, const FString& FilePath)
+{
+    return FFileHelper::SaveArrayToFile(Write(Result), *FilePath);
+}
+
+bool FBPBinaryFormat::SaveToFile(const FBPProjectAnalysis& Analysis, const FString& FilePath)
+{
+    return FFileHelper::SaveArrayToFile(Write(Analysis), *FilePath);
+}
+
+bool FBPBinaryFormat::LoadFromFile(const FString& FilePath, FBlueprintAnalysisResult& OutResult)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: could not read %s"), *FilePath);
+        return false;
+    }
+    return Read(Bytes, OutResult);
+}
+
+bool FBPBinaryFormat::LoadFromFile(const FString& FilePath, FBPProjectAnalysis& OutAnalysis)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: could not read %s"), *FilePath);
+        return false;
+    }
+    return Read(Bytes, OutAnalysis);
+}
@@ -0,0 +1,336 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/Blueprint.h"
+#include "UObject/Package.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// 'BPAC'
+static constexpr uint32 CacheFileMagic = 0x43415042;
+
+// Entries no run has found or stored for this long belong to deleted, renamed or abandoned assets
+static const FTimespan MaxEntryAge = FTimespan::FromDays(30);
+
+// ============================================================
+// Serialization helpers
+// ============================================================
+
+// Counts come from the file and every element takes at least one byte, so a count past the
+// end of the data is corruption and must not reach SetNum
+static void SerializeCount(FArchive& Ar, int32& Num)
+{
+    Ar << Num;
+    if (Ar.IsLoading() && (Num < 0 || Num > Ar.TotalSize() - Ar.Tell()))
+    {
+        Ar.SetError();
+        Num = 0;
+    }
+}
+
+template<typename ElementType, typename SerializeFuncType>
+static void SerializeArray(FArchive& Ar, TArray<ElementType>& Array, SerializeFuncType SerializeElement)
+{
+    int32 Num = Array.Num();
+    SerializeCount(Ar, Num);
+    if (Ar.IsLoading())
+    {
+        Array.SetNum(Num);
+    }
+    for (ElementType& Element : Array)
+    {
+        if (Ar.IsError()) return;
+        SerializeElement(Ar, Element);
+    }
+}
+
+static void SerializeSummary(FArchive& Ar, FBPBlueprintSummary& Summary)
+{
+    Ar << Summary.BlueprintName;
+    Ar << Summary.BlueprintPath;
+    Ar << Summary.BlueprintType;
+    Ar << Summary.NodeCount;
+    Ar << Summary.PerformanceScore;
+    Ar << Summary.CriticalIssues;
+    Ar << Summary.EstimatedTokenCount;
+    Ar << Summary.EstimatedTickCost;
+    Ar << Summary.ParentClass;
+    Ar << Summary.ImplementedInterfaces;
+}
+
+static void SerializeIssue(FArchive& Ar, FBPPerformanceIssue& Issue)
+{
+    uint8 Severity = static_cast<uint8>(Issue.Severity);
+
+    Ar << Issue.IssueType;
+    Ar << Issue.Description;
+    Ar << Issue.Recommendation;
+    Ar << Severity;
+    Ar << Issue.NodeGuid;
+    Ar << Issue.GraphName;
+    Ar << Issue.Deduction;
+    Ar << Issue.EntryPath;
+
+    Issue.Severity = static_cast<EBPPerformanceSeverity>(Severity);
+}
+
+static void SerializeNodeCost(FArchive& Ar, FBPNodeCost& NodeCost)
+{
+    Ar << NodeCost.NodeGuid;
+    Ar << NodeCost.Summary;
+    Ar << NodeCost.GraphName;
+    Ar << NodeCost.Cost;
+    Ar << NodeCost.LoopNesting;
+}
+
+static void SerializeTickPathCost(FArchive& Ar, FBPTickPathCost& PathCost)
+{
+    Ar << PathCost.EntryPointName;
+    Ar << PathCost.EntryNodeGuid;
+    Ar << PathCost.GraphName;
+    Ar << PathCost.EstimatedCost;
+    Ar << PathCost.MaxLoopNesting;
+
+    SerializeArray(Ar, PathCost.CostBreakdown, &SerializeNodeCost);
+}
+
+static void SerializeReport(FArchive& Ar, FBPPerformanceReport& Report)
+{
+    Ar << Report.BlueprintName;
+    Ar << Report.AnalysisTimestamp;
+    Ar << Report.TotalNodes;
+    Ar << Report.EventCount;
+    Ar << Report.CastCount;
+    Ar << Report.TickNodeCount;
+    Ar << Report.BeginPlayNodeCount;
+    Ar << Report.EstimatedTickCost;
+    Ar << Report.PerformanceScore;
+
+    SerializeArray(Ar, Report.TickPathCosts, &SerializeTickPathCost);
+    SerializeArray(Ar, Report.Issues, &SerializeIssue);
+}
+
+static void SerializeDependency(FArchive& Ar, FBPDependency& Dep)
+{
+    Ar << Dep.ReferencingBlueprint;
+    Ar << Dep.ReferencedClass;
+    Ar << Dep.ReferenceType;
+    Ar << Dep.NodeGuid;
+    Ar << Dep.GraphName;
+}
+
+static void SerializeEntry(FArchive& Ar, FBPAnalysisCacheEntry& Entry)
+{
+    Ar << Entry.PackageSavedHash;
+    Ar << Entry.LastUsedTicks;
+    SerializeArray(Ar, Entry.MacroPackageHashes, [](FArchive& InAr, FBPPackageHash& PackageHash) { InAr << PackageHash; });
+    Ar << Entry.TraceLimits;
+    SerializeSummary(Ar, Entry.Summary);
+    SerializeReport(Ar, Entry.PerformanceReport);
+
+    SerializeArray(Ar, Entry.Dependencies, &SerializeDependency);
+
+    if (!Ar.IsError())
+    {
+        Ar << Entry.IndexRows;
+    }
+}
+
+// ============================================================
+// FBPAnalysisCache
+// ============================================================
+
+FBPAnalysisCache& FBPAnalysisCache::Get()
+{
+    static FBPAnalysisCache Instance;
+    return Instance;
+}
+
+FString FBPAnalysisCache::GetCacheFilePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintAnalyzer"), TEXT("AnalysisCache.bin"));
+}
+
+FIoHash FBPAnalysisCache::GetPackageSavedHash(FName PackageName)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+    return PackageData.IsSet() ? PackageData->GetPackageSavedHash() : FIoHash::Zero;
+}
+
+bool FBPAnalysisCache::GetPackageSavedHashes(const TArray<FName>& Packages, TArray<FBPPackageHash>& OutHashes)
+{
+    OutHashes.Reset(Packages.Num());
+    for (const FName PackageName : Packages)
+    {
+        const UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+        if (Package && Package->IsDirty()) return false;
+
+        const FIoHash SavedHash = GetPackageSavedHash(PackageName);
+        if (SavedHash.IsZero()) return false;
+
+        OutHashes.Add({ PackageName, SavedHash });
+    }
+    return true;
+}
+
+bool FBPAnalysisCache::AreSavedHashesCurrent(const TArray<FBPPackageHash>& PackageHashes)
+{
+    for (const FBPPackageHash& PackageHash : PackageHashes)
+    {
+        const UPackage* Package = FindPackage(nullptr, *PackageHash.PackageName.ToString());
+        if (Package && Package->IsDirty()) return false;
+
+        if (GetPackageSavedHash(PackageHash.PackageName) != PackageHash.SavedHash) return false;
+    }
+    return true;
+}
+
+void FBPAnalysisCache::LoadIfNeeded()
+{
+    check(IsInGameThread());
+
+    if (bLoaded) return;
+    bLoaded = true;
+
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetCacheFilePath(), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Ar(Bytes);
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    int32 NumEntries = 0;
+    Ar << Magic;
+    Ar << Version;
+
+    // Results from another analyzer version may differ; start over rather than mix them
+    if (Ar.IsError() || Magic != CacheFileMagic || Version != AnalyzerVersion)
+    {
+        UE_LOG(LogTemp, Log, TEXT("BlueprintAnalyzer: discarding analysis cache (version %u, expected %u)"), Version, AnalyzerVersion);
+        return;
+    }
+
+    SerializeCount(Ar, NumEntries);
+    Entries.Reserve(NumEntries);
+    for (int32 i = 0; i < NumEntries && !Ar.IsError(); ++i)
+    {
+        FString ObjectPath;
+        FBPAnalysisCacheEntry Entry;
+        Ar << ObjectPath;
+        SerializeEntry(Ar, Entry);
+        Entries.Add(MoveTemp(ObjectPath), MoveTemp(Entry));
+    }
+
+    if (Ar.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: analysis cache is corrupt, ignoring it"));
+        Entries.Reset();
+    }
+}
+
+const FBPAnalysisCacheEntry* FBPAnalysisCache::Find(const FString& ObjectPath, const FIoHash& SavedHash, const FBPTraceLimits& Limits)
+{
+    LoadIfNeeded();
+
+    FBPAnalysisCacheEntry* Entry = SavedHash.IsZero() ? nullptr : Entries.Find(ObjectPath);
+    if (Entry && Entry->PackageSavedHash == SavedHash && Entry->TraceLimits == Limits && AreSavedHashesCurrent(Entry->MacroPackageHashes))
+    {
+        // Refreshed at most daily so runs that only hit the cache rarely rewrite the file
+        const int64 NowTicks = FDateTime::UtcNow().GetTicks();
+        if (NowTicks - Entry->LastUsedTicks > ETimespan::TicksPerDay)
+        {
+            Entry->LastUsedTicks = NowTicks;
+            bDirty = true;
+        }
+
+        NumHits++;
+        return Entry;
+    }
+
+    NumMisses++;
+    return nullptr;
+}
+
+const FBPAnalysisCacheEntry* FBPAnalysisCache::FindForBlueprint(UBlueprint* Blueprint)
+{
+    if (!Blueprint) return nullptr;
+
+    // In-memory edits are not reflected in the saved hash
+    UPackage* Package = Blueprint->GetOutermost();
+    if (!Package || Package->IsDirty()) return nullptr;
+
+    return Find(Blueprint->GetPathName(), GetPackageSavedHash(Package->GetFName()), FBPTraceLimits::FromConsoleVariables());
+}
+
+void FBPAnalysisCache::Store(const FString& ObjectPath, FBPAnalysisCacheEntry&& Entry)
+{
+    LoadIfNeeded();
+
+    if (Entry.PackageSavedHash.IsZero()) return;
+
+    Entry.LastUsedTicks = FDateTime::UtcNow().GetTicks();
+    Entries.Add(ObjectPath, MoveTemp(Entry));
+    bDirty = true;
+}
+
+void FBPAnalysisCache::Save()
+{
+    check(IsInGameThread());
+
+    if (!bDirty) return;
+
+    const int64 OldestTicks = (FDateTime::UtcNow() - MaxEntryAge).GetTicks();
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (It.Value().LastUsedTicks < OldestTicks)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Ar(Bytes);
+
+    uint32 Magic = CacheFileMagic;
+    uint32 Version = AnalyzerVersion;
+    int32 NumEntries = Entries.Num();
+    Ar << Magic;
+    Ar << Version;
+    Ar << NumEntries;
+
+    for (TPair<FString, FBPAnalysisCacheEntry>& Pair : Entries)
+    {
+        Ar << Pair.Key;
+        SerializeEntry(Ar, Pair.Value);
+    }
+
+    if (FFileHelper::SaveArrayToFile(Bytes, *GetCacheFilePath()))
+    {
+        bDirty = false;
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: failed to write analysis cache to %s"), *GetCacheFilePath());
+    }
+}
+
+void FBPAnalysisCache::Clear()
+{
+    check(IsInGameThread());
+
+    Entries.Reset();
+    bLoaded = true;
+    bDirty = true;
+    NumHits = 0;
+    NumMisses = 0;
+}
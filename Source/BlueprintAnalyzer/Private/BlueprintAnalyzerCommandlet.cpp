@@ -0,0 +1,208 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerCommandlet.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerPipeline.h"
+#include "BlueprintAnalyzerProfiling.h"
+#include "BlueprintAnalyzerRegistryScan.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+// Splits "-Key=A+B,C" into { A, B, C }
+static TArray<FString> ParseListArgument(const FString& Params, const TCHAR* Key)
+{
+    TArray<FString> Out;
+
+    FString Value;
+    if (FParse::Value(*Params, Key, Value, false))
+    {
+        static const TCHAR* Delimiters[] = { TEXT("+"), TEXT(",") };
+        Value.ParseIntoArray(Out, Delimiters, UE_ARRAY_COUNT(Delimiters), true);
+        for (FString& Item : Out)
+        {
+            Item.TrimStartAndEndInline();
+        }
+    }
+    return Out;
+}
+
+// Logs how long each stage took once the stage ends
+class FBPStageTimer
+{
+public:
+    explicit FBPStageTimer(const TCHAR* InStageName)
+        : StageName(InStageName)
+        , StartTime(FPlatformTime::Seconds())
+    {
+    }
+
+    ~FBPStageTimer()
+    {
+        UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: [stage] %-10s %8.3f s"), StageName, FPlatformTime::Seconds() - StartTime);
+    }
+
+private:
+    const TCHAR* StageName;
+    double StartTime;
+};
+
+UBlueprintAnalyzerCommandlet::UBlueprintAnalyzerCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UBlueprintAnalyzerCommandlet::Main(const FString& Params)
+{
+    const double TotalStartTime = FPlatformTime::Seconds();
+
+    const TArray<FString> FolderPaths = ParseListArgument(Params, TEXT("Folders="));
+    const TArray<FString> PackageNames = ParseListArgument(Params, TEXT("Packages="));
+    if (FolderPaths.Num() == 0 && PackageNames.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("BlueprintAnalyzer: nothing to analyze; pass -Folders=/Game/Path[+...] and/or -Packages=/Game/Path/BP_Name[+...]"));
+        return 1;
+    }
+
+    FString OutputDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintAnalyzer"));
+    FParse::Value(*Params, TEXT("OutputDir="), OutputDir, false);
+    OutputDir = FPaths::ConvertRelativePathToFull(OutputDir);
+
+    FString Format = TEXT("JSON");
+    FParse::Value(*Params, TEXT("Format="), Format);
+    Format.ToUpperInline();
+    if (Format != TEXT("JSON") && Format != TEXT("TEXT") && Format != TEXT("BINARY") && Format != TEXT("ALL"))
+    {
+        UE_LOG(LogTemp, Error, TEXT("BlueprintAnalyzer: unknown -Format=%s (expected JSON, TEXT, BINARY or ALL)"), *Format);
+        return 1;
+    }
+
+    FBPFolderAnalysisOptions Options;
+    FParse::Value(*Params, TEXT("Workers="), Options.WorkerCount);
+    FParse::Value(*Params, TEXT("ChunkSize="), Options.ChunkSize);
+    FParse::Value(*Params, TEXT("MemoryCeilingMB="), Options.MemoryCeilingMB);
+    FParse::Value(*Params, TEXT("Prefetch="), Options.PrefetchWindow);
+    Options.bUseCache = !FParse::Param(*Params, TEXT("NoCache"));
+    Options.bQuickScan = FParse::Param(*Params, TEXT("QuickScan"));
+    if (!FParse::Value(*Params, TEXT("Index="), Options.IndexFilePath, false) && FParse::Param(*Params, TEXT("Index")))
+    {
+        Options.IndexFilePath = TEXT("ProjectIndex.bpidx");
+    }
+
+    if (FParse::Param(*Params, TEXT("Profile")))
+    {
+        FBPStageProfiler::SetEnabled(true);
+    }
+    const FBPStageProfiler::FRun StageRun;
+
+    if (!IFileManager::Get().MakeDirectory(*OutputDir, true))
+    {
+        UE_LOG(LogTemp, Error, TEXT("BlueprintAnalyzer: cannot create output directory %s"), *OutputDir);
+        return 1;
+    }
+    if (!Options.IndexFilePath.IsEmpty())
+    {
+        Options.IndexFilePath = FPaths::ConvertRelativePathToFull(OutputDir, Options.IndexFilePath);
+    }
+
+    // Commandlets start before the registry has finished its initial scan
+    {
+        FBPStageTimer Timer(TEXT("Discovery"));
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        AssetRegistry.SearchAllAssets(true);
+    }
+
+    TArray<FAssetData> Assets;
+    {
+        FBPStageTimer Timer(TEXT("Gather"));
+        Assets = UBlueprintAnalyzerLibrary::FindBlueprintAssets(FolderPaths, PackageNames);
+    }
+
+    TArray<FString> Sources = FolderPaths;
+    Sources.Append(PackageNames);
+    const FString SourceLabel = FString::Join(Sources, TEXT(", "));
+
+    UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: %d Blueprints in %s (workers: %d, cache: %s, quick scan: %s, chunk: %d, ceiling: %d MB, prefetch: %d)"),
+        Assets.Num(), *SourceLabel, Options.WorkerCount,
+        Options.bUseCache ? TEXT("on") : TEXT("off"), Options.bQuickScan ? TEXT("on") : TEXT("off"),
+        Options.ChunkSize, Options.MemoryCeilingMB, Options.PrefetchWindow);
+
+    FBPProjectAnalysis Analysis;
+    if (Options.bQuickScan)
+    {
+        FBPStageTimer Timer(TEXT("QuickScan"));
+        Analysis = FBPRegistryScan::ScanFolder(SourceLabel, Assets);
+    }
+    else
+    {
+        FBPAnalysisPipeline Pipeline(SourceLabel, Assets, Options);
+        {
+            FBPStageTimer Timer(TEXT("Analyze"));
+
+            const int32 ProgressInterval = FMath::Max(1, Assets.Num() / 20);
+            while (Pipeline.Step())
+            {
+                if (Pipeline.GetNumDispatched() % ProgressInterval == 0)
+                {
+                    UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: %d / %d dispatched"), Pipeline.GetNumDispatched(), Pipeline.GetNumAssets());
+                }
+            }
+        }
+        {
+            FBPStageTimer Timer(TEXT("Merge"));
+            Analysis = Pipeline.Finish();
+        }
+    }
+
+    bool bWritten = true;
+    {
+        FBPStageTimer Timer(TEXT("Export"));
+
+        if (Format == TEXT("JSON") || Format == TEXT("ALL"))
+        {
+            const FString JsonPath = FPaths::Combine(OutputDir, TEXT("ProjectAnalysis.json"));
+            const bool bOk = UBlueprintAnalyzerLibrary::SaveProjectAnalysisToFile(Analysis, JsonPath, TEXT("JSON"));
+            UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: %s %s"), bOk ? TEXT("wrote") : TEXT("FAILED to write"), *JsonPath);
+            bWritten &= bOk;
+        }
+        if (Format == TEXT("TEXT") || Format == TEXT("ALL"))
+        {
+            const FString TextPath = FPaths::Combine(OutputDir, TEXT("ProjectAnalysis_LLM.txt"));
+            const bool bOk = UBlueprintAnalyzerLibrary::SaveProjectAnalysisToFile(Analysis, TextPath, TEXT("TEXT"));
+            UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: %s %s"), bOk ? TEXT("wrote") : TEXT("FAILED to write"), *TextPath);
+            bWritten &= bOk;
+        }
+        if (Format == TEXT("BINARY") || Format == TEXT("ALL"))
+        {
+            const FString BinaryPath = FPaths::Combine(OutputDir, TEXT("ProjectAnalysis.bpab"));
+            const bool bOk = UBlueprintAnalyzerLibrary::SaveProjectAnalysisToFile(Analysis, BinaryPath, TEXT("BINARY"));
+            UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: %s %s"), bOk ? TEXT("wrote") : TEXT("FAILED to write"), *BinaryPath);
+            bWritten &= bOk;
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: %d Blueprints, %d nodes, average score %.1f, %d dependency cycles, %.3f s total"),
+        Analysis.BlueprintsAnalyzed, Analysis.TotalNodes, Analysis.AveragePerformanceScore,
+        Analysis.DependencyCycles.Num(), FPlatformTime::Seconds() - TotalStartTime);
+    UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: peak working set %lld MB, %d chunk collections, %d load stalls (%.3f s)"),
+        Analysis.PeakWorkingSetBytes / (1024 * 1024), Analysis.ChunkCollections, Analysis.LoadStalls, Analysis.LoadStallSeconds);
+
+    // Whole run including exports, which happen after the report's own StageTimings were taken
+    if (FBPStageProfiler::IsEnabled())
+    {
+        for (const FBPStageTiming& Timing : StageRun.GetTimings())
+        {
+            UE_LOG(LogTemp, Display, TEXT("BlueprintAnalyzer: [profile] %-20s %6d calls %10.3f s  peak %lld MB"),
+                *Timing.Stage, Timing.Calls, Timing.WallSeconds, Timing.PeakUsedPhysicalBytes / (1024 * 1024));
+        }
+    }
+
+    return bWritten ? 0 : 1;
+}
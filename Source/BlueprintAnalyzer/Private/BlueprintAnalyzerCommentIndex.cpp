@@ -0,0 +1,116 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerCommentIndex.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+
+// A box touching more cells than this is kept out of the grid
+static constexpr int64 MaxCellsPerComment = 1024;
+
+FBPCommentIndex::FBPCommentIndex(TArray<FBPCommentBox> InComments)
+    : Comments(MoveTemp(InComments))
+{
+    if (Comments.Num() == 0) return;
+
+    // Size cells to the median box extent so a typical comment lands in a handful of cells
+    TArray<float> Extents;
+    Extents.Reserve(Comments.Num());
+    for (const FBPCommentBox& Box : Comments)
+    {
+        Extents.Add(FMath::Max(Box.Right - Box.Left, Box.Bottom - Box.Top));
+    }
+    Extents.Sort();
+    CellSize = FMath::Clamp(Extents[Extents.Num() / 2], 256.f, 4096.f);
+
+    for (int32 Index = 0; Index < Comments.Num(); ++Index)
+    {
+        const FBPCommentBox& Box = Comments[Index];
+        const int32 MinX = CellCoord(Box.Left);
+        const int32 MinY = CellCoord(Box.Top);
+        const int32 MaxX = CellCoord(Box.Right);
+        const int32 MaxY = CellCoord(Box.Bottom);
+
+        if (int64(MaxX - MinX + 1) * int64(MaxY - MinY + 1) > MaxCellsPerComment)
+        {
+            Oversized.Add(Index);
+            continue;
+        }
+
+        for (int32 CellY = MinY; CellY <= MaxY; ++CellY)
+        {
+            for (int32 CellX = MinX; CellX <= MaxX; ++CellX)
+            {
+                Cells.FindOrAdd(CellKey(CellX, CellY)).Add(Index);
+            }
+        }
+    }
+}
+
+FBPCommentIndex FBPCommentIndex::ForGraph(const UEdGraph* Graph)
+{
+    TArray<FBPCommentBox> Boxes;
+    if (!Graph) return FBPCommentIndex();
+
+    for (const UEdGraphNode* GraphNode : Graph->Nodes)
+    {
+        const UEdGraphNode_Comment* Comment = Cast<UEdGraphNode_Comment>(GraphNode);
+        if (!Comment) continue;
+
+        FBPCommentBox& Box = Boxes.AddDefaulted_GetRef();
+        Box.Left = Comment->NodePosX;
+        Box.Top = Comment->NodePosY;
+        Box.Right = Box.Left + FMath::Max(Comment->NodeWidth, 0);
+        Box.Bottom = Box.Top + FMath::Max(Comment->NodeHeight, 0);
+        Box.Text = Comment->NodeComment;
+    }
+
+    return FBPCommentIndex(MoveTemp(Boxes));
+}
+
+int32 FBPCommentIndex::FindInnermost(float Left, float Top, float Right, float Bottom) const
+{
+    int32 Best = INDEX_NONE;
+    float BestArea = 0.f;
+
+    // Smallest containing box; equal areas keep the earlier comment, as the old linear scan did
+    auto Consider = [&](int32 Index)
+    {
+        const FBPCommentBox& Box = Comments[Index];
+        if (!Box.Contains(Left, Top, Right, Bottom)) return;
+
+        const float Area = Box.GetArea();
+        if (Best == INDEX_NONE || Area < BestArea || (Area == BestArea && Index < Best))
+        {
+            Best = Index;
+            BestArea = Area;
+        }
+    };
+
+    // Any containing box also contains the top-left corner, so that cell holds every candidate
+    if (const TArray<int32>* Bucket = Cells.Find(CellKey(CellCoord(Left), CellCoord(Top))))
+    {
+        for (int32 Index : *Bucket)
+        {
+            Consider(Index);
+        }
+    }
+    for (int32 Index : Oversized)
+    {
+        Consider(Index);
+    }
+
+    return Best;
+}
+
+FString FBPCommentIndex::FindCommentGroup(const UEdGraphNode* Node) const
+{
+    if (!Node || Comments.Num() == 0) return FString();
+
+    const float NodeLeft = Node->NodePosX;
+    const float NodeTop = Node->NodePosY;
+    const float NodeRight = NodeLeft + FMath::Max(Node->NodeWidth, 100);
+    const float NodeBottom = NodeTop + FMath::Max(Node->NodeHeight, 50);
+
+    const int32 Index = FindInnermost(NodeLeft, NodeTop, NodeRight, NodeBottom);
+    return Index != INDEX_NONE ? Comments[Index].Text : FString();
+}
@@ -0,0 +1,272 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerCostModel.h"
+#include "Algo/StableSort.h"
+
+struct FBPFunctionWeight
+{
+    const TCHAR* Name;
+    float Weight;
+};
+
+// First match wins, so more specific names come first
+static const FBPFunctionWeight FunctionWeights[] = {
+    { TEXT("GetAllActorsOfClass"), 200.0f },
+    { TEXT("GetAllActorsWithInterface"), 200.0f },
+    { TEXT("GetAllActorsWithTag"), 200.0f },
+    { TEXT("GetAllWidgetsOfClass"), 150.0f },
+    { TEXT("FindPathToLocation"), 150.0f },
+    { TEXT("SpawnEmitter"), 60.0f },
+    { TEXT("SpawnSound"), 40.0f },
+    { TEXT("LineTraceMulti"), 60.0f },
+    { TEXT("LineTrace"), 40.0f },
+    { TEXT("SphereTrace"), 60.0f },
+    { TEXT("BoxTrace"), 60.0f },
+    { TEXT("CapsuleTrace"), 60.0f },
+    { TEXT("OverlapActors"), 60.0f },
+    { TEXT("OverlapComponents"), 60.0f },
+    { TEXT("GetOverlappingActors"), 40.0f },
+    { TEXT("GetComponentsByClass"), 30.0f },
+    { TEXT("GetComponentByClass"), 10.0f },
+    { TEXT("PrintString"), 20.0f },
+    { TEXT("PrintText"), 20.0f },
+    { TEXT("Array_Find"), 10.0f },
+    { TEXT("Array_Contains"), 10.0f },
+    { TEXT("Array_Remove"), 10.0f },
+    { TEXT("Format"), 5.0f },
+    { TEXT("Concat_Str"), 5.0f },
+    { TEXT("Append"), 5.0f },
+    { TEXT("Conv_"), 3.0f },
+};
+
+static constexpr float DefaultCallWeight = 2.0f;
+
+FBPCostModel::FBPCostModel(const FBPBlueprintSnapshot& InSnapshot)
+    : Snapshot(InSnapshot)
+{
+    IsPure.Init(false, Snapshot.Nodes.Num());
+    for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+    {
+        const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+        if (Node.bIsEvent || Node.bIsFunctionEntry || Node.bIsTunnelEntry || Node.bIsTunnelExit) continue;
+
+        bool bHasExec = false;
+        for (const FBPPinSnapshot& Pin : Snapshot.GetPins(Node))
+        {
+            bHasExec |= Pin.bIsExec;
+        }
+        IsPure[NodeIndex] = !bHasExec;
+    }
+}
+
+float FBPCostModel::GetFunctionWeight(const FString& FunctionName)
+{
+    for (const FBPFunctionWeight& Entry : FunctionWeights)
+    {
+        if (FunctionName.Contains(Entry.Name)) return Entry.Weight;
+    }
+    return DefaultCallWeight;
+}
+
+float FBPCostModel::GetNodeWeight(const FBPBlueprintSnapshot& Snapshot, const FBPNodeSnapshot& Node)
+{
+    // Entry and exit points only hand control over; a collapsed node's work is its body
+    if (Node.bIsEvent || Node.bIsFunctionEntry || Node.bIsTunnelEntry || Node.bIsTunnelExit) return 0.0f;
+    if (Node.NodeType == TEXT("Reroute") || Node.NodeType == TEXT("FunctionResult") || Node.NodeType == TEXT("CollapsedGraph")) return 0.0f;
+
+    if (Node.MacroIndex != INDEX_NONE)
+    {
+        // The macro's own nodes (counters, compares, array gets) run once per iteration when it loops
+        const FBPMacroSummary& Macro = *Snapshot.Macros[Node.MacroIndex];
+        float Weight = static_cast<float>(Macro.NodeCount);
+        for (const FString& FunctionName : Macro.CalledFunctions)
+        {
+            Weight += GetFunctionWeight(FunctionName) - 1.0f;
+        }
+        return Macro.bHasLoop ? Weight * AssumedLoopIterations : Weight;
+    }
+
+    if (Node.bIsCallFunction) return GetFunctionWeight(Node.CallFunctionName);
+    if (Node.bIsSpawnActor) return 100.0f;
+    if (Node.bIsCast) return 3.0f;
+    if (Node.bIsBranch || Node.bIsSequence) return 0.5f;
+    if (Node.NodeType == TEXT("VariableGet") || Node.NodeType == TEXT("VariableSet")) return 0.5f;
+
+    return 1.0f;
+}
+
+float FBPCostModel::GetLoopMultiplier(int32 LoopNesting)
+{
+    return FMath::Pow(AssumedLoopIterations, static_cast<float>(LoopNesting));
+}
+
+void FBPCostModel::Reach(int32 EntryNode, bool bIntoCallees, FBPExecReach& Out) const
+{
+    struct FPending
+    {
+        int32 NodeIndex;
+        int32 Parent;
+        int32 LoopNesting;
+    };
+
+    TArray<FPending> Stack;
+    Stack.Push({ EntryNode, INDEX_NONE, 0 });
+
+    // A node is walked again only when reached deeper inside loops; nesting is capped, so this terminates
+    while (Stack.Num() > 0)
+    {
+        const FPending Current = Stack.Pop(EAllowShrinking::No);
+
+        if (int32* Known = Out.Nesting.Find(Current.NodeIndex))
+        {
+            if (Current.LoopNesting <= *Known) continue;
+            *Known = Current.LoopNesting;
+        }
+        else
+        {
+            Out.Nesting.Add(Current.NodeIndex, Current.LoopNesting);
+            Out.Order.Add(Current.NodeIndex);
+        }
+        Out.Parent.Add(Current.NodeIndex, Current.Parent);
+
+        const FBPNodeSnapshot& Node = Snapshot.Nodes[Current.NodeIndex];
+        const FBPMacroSummary* Macro = Node.MacroIndex != INDEX_NONE ? &Snapshot.Macros[Node.MacroIndex].Get() : nullptr;
+
+        for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+        {
+            const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+            if (!Pin.bIsExec || Pin.Direction != EGPD_Output) continue;
+
+            const bool bLoopBody = Macro && Macro->IsLoopOutput(Pin.PinName);
+            const int32 NextNesting = FMath::Min(Current.LoopNesting + (bLoopBody ? 1 : 0), MaxLoopNesting);
+
+            for (const FBPPinLink& Link : Snapshot.GetLinks(PinIndex))
+            {
+                if (!Link.IsExternal())
+                {
+                    Stack.Push({ Link.NodeIndex, Current.NodeIndex, NextNesting });
+                }
+            }
+        }
+
+        // Pushed last so it pops first: the callee body runs before the flow after the call
+        if (bIntoCallees && Node.CalleeEntryNode != INDEX_NONE)
+        {
+            Stack.Push({ Node.CalleeEntryNode, Current.NodeIndex, Current.LoopNesting });
+        }
+    }
+}
+
+float FBPCostModel::GetPureInputCost(int32 NodeIndex)
+{
+    // Each pure node in the input closure is evaluated once per execution of the consumer
+    float Cost = 0.0f;
+    TSet<int32, DefaultKeyFuncs<int32>, TInlineSetAllocator<16>> Seen;
+    TArray<int32, TInlineAllocator<16>> Stack;
+    Stack.Append(Snapshot.GetDataSources(NodeIndex).GetData(), Snapshot.GetDataSources(NodeIndex).Num());
+
+    while (Stack.Num() > 0)
+    {
+        const int32 Source = Stack.Pop(EAllowShrinking::No);
+        bool bAlreadySeen = false;
+        Seen.Add(Source, &bAlreadySeen);
+
+        // Outputs of impure nodes are values cached when they ran
+        if (bAlreadySeen || !IsPure[Source]) continue;
+
+        const FBPNodeSnapshot& SourceNode = Snapshot.Nodes[Source];
+        Cost += GetNodeWeight(Snapshot, SourceNode);
+        if (SourceNode.CalleeEntryNode != INDEX_NONE)
+        {
+            Cost += GetBodyCost(SourceNode.CalleeEntryNode);
+        }
+
+        for (const int32 Next : Snapshot.GetDataSources(Source))
+        {
+            Stack.Push(Next);
+        }
+    }
+
+    return Cost;
+}
+
+float FBPCostModel::GetExecutedCost(int32 NodeIndex)
+{
+    const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+
+    float Cost = GetNodeWeight(Snapshot, Node) + GetPureInputCost(NodeIndex);
+    if (Node.CalleeEntryNode != INDEX_NONE)
+    {
+        Cost += GetBodyCost(Node.CalleeEntryNode);
+    }
+    return Cost;
+}
+
+float FBPCostModel::GetBodyCost(int32 EntryNode)
+{
+    if (const float* Known = BodyCosts.Find(EntryNode))
+    {
+        return *Known;
+    }
+
+    // Recursion: the recursive call adds nothing beyond the call itself
+    bool bAlreadyInProgress = false;
+    BodiesInProgress.Add(EntryNode, &bAlreadyInProgress);
+    if (bAlreadyInProgress) return 0.0f;
+
+    // Callee bodies are added per call by GetExecutedCost, so the reach stays in this graph
+    FBPExecReach BodyReach;
+    Reach(EntryNode, false, BodyReach);
+
+    float Cost = 0.0f;
+    for (const int32 NodeIndex : BodyReach.Order)
+    {
+        Cost += GetExecutedCost(NodeIndex) * GetLoopMultiplier(BodyReach.Nesting[NodeIndex]);
+    }
+
+    BodiesInProgress.Remove(EntryNode);
+    BodyCosts.Add(EntryNode, Cost);
+    return Cost;
+}
+
+FBPTickPathCost FBPCostModel::EstimatePath(int32 EntryNode)
+{
+    const FBPNodeSnapshot& Entry = Snapshot.Nodes[EntryNode];
+
+    FBPTickPathCost PathCost;
+    PathCost.EntryPointName = Entry.Title;
+    PathCost.EntryNodeGuid = Entry.NodeGuid.ToString();
+    PathCost.GraphName = Snapshot.GetGraph(Entry).GraphName;
+
+    FBPExecReach PathReach;
+    Reach(EntryNode, false, PathReach);
+
+    TArray<FBPNodeCost> NodeCosts;
+    for (const int32 NodeIndex : PathReach.Order)
+    {
+        const int32 LoopNesting = PathReach.Nesting[NodeIndex];
+        const float Cost = GetExecutedCost(NodeIndex) * GetLoopMultiplier(LoopNesting);
+
+        PathCost.EstimatedCost += Cost;
+        PathCost.MaxLoopNesting = FMath::Max(PathCost.MaxLoopNesting, LoopNesting);
+        if (Cost <= 0.0f) continue;
+
+        const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+        FBPNodeCost& NodeCost = NodeCosts.AddDefaulted_GetRef();
+        NodeCost.NodeGuid = Node.NodeGuid.ToString();
+        NodeCost.Summary = Node.StepSummary;
+        NodeCost.GraphName = Snapshot.GetGraph(Node).GraphName;
+        NodeCost.Cost = Cost;
+        NodeCost.LoopNesting = LoopNesting;
+    }
+
+    // Stable, so equal costs keep reach order
+    Algo::StableSortBy(NodeCosts, [](const FBPNodeCost& NodeCost) { return -NodeCost.Cost; });
+    if (NodeCosts.Num() > MaxBreakdownNodes)
+    {
+        NodeCosts.SetNum(MaxBreakdownNodes);
+    }
+    PathCost.CostBreakdown = MoveTemp(NodeCosts);
+
+    return PathCost;
+}
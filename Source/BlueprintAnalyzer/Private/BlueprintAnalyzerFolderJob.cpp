@@ -0,0 +1,173 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerFolderJob.h"
+#include "BlueprintAnalyzerPipeline.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Timespan.h"
+
+// Game thread time spent stepping the pipeline per editor frame
+static constexpr double JobTickBudgetSeconds = 0.010;
+
+// Minimum interval between notification text updates
+static constexpr double NotificationUpdateSeconds = 0.25;
+
+TSharedRef<FBPFolderAnalysisJob> FBPFolderAnalysisJob::Start(const FString& FolderPath, const FBPFolderAnalysisOptions& Options)
+{
+    check(IsInGameThread());
+
+    TSharedRef<FBPFolderAnalysisJob> Job = MakeShareable(new FBPFolderAnalysisJob());
+    Job->FolderPath = FolderPath;
+    Job->StartTime = FPlatformTime::Seconds();
+    Job->bRunning = true;
+    Job->SelfReference = Job;
+
+    const TArray<FAssetData> Assets = UBlueprintAnalyzerLibrary::FindBlueprintAssets({ FolderPath }, {});
+    Job->Pipeline = MakeUnique<FBPAnalysisPipeline>(FolderPath, Assets, Options);
+
+    TWeakPtr<FBPFolderAnalysisJob> WeakJob = Job;
+    Job->Pipeline->SetOnAssetCompleted([WeakJob](const FBPBlueprintSummary& Summary)
+    {
+        if (TSharedPtr<FBPFolderAnalysisJob> PinnedJob = WeakJob.Pin())
+        {
+            PinnedJob->AssetAnalyzedEvent.Broadcast(Summary);
+        }
+    });
+
+    Job->TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(Job, &FBPFolderAnalysisJob::Tick));
+    Job->ShowNotification();
+
+    UE_LOG(LogTemp, Log, TEXT("BlueprintAnalyzer: background analysis of %s started (%d Blueprints)"), *FolderPath, Assets.Num());
+    return Job;
+}
+
+FBPFolderAnalysisJob::~FBPFolderAnalysisJob()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+}
+
+void FBPFolderAnalysisJob::Cancel()
+{
+    if (bRunning)
+    {
+        bCancelRequested = true;
+    }
+}
+
+int32 FBPFolderAnalysisJob::GetNumAssets() const
+{
+    return Pipeline ? Pipeline->GetNumAssets() : 0;
+}
+
+int32 FBPFolderAnalysisJob::GetNumCompleted() const
+{
+    return Pipeline ? Pipeline->GetNumCompleted() : 0;
+}
+
+double FBPFolderAnalysisJob::GetEstimatedSecondsRemaining() const
+{
+    const int32 NumCompleted = GetNumCompleted();
+    if (NumCompleted == 0) return -1.0;
+
+    const double Elapsed = FPlatformTime::Seconds() - StartTime;
+    return Elapsed / NumCompleted * (GetNumAssets() - NumCompleted);
+}
+
+bool FBPFolderAnalysisJob::Tick(float DeltaTime)
+{
+    if (!bRunning) return false;
+
+    // Delegates fired from Step may release the caller's last reference
+    TSharedRef<FBPFolderAnalysisJob> KeepAlive = AsShared();
+
+    if (bCancelRequested)
+    {
+        Complete(true);
+        return false;
+    }
+
+    const double TickEndTime = FPlatformTime::Seconds() + JobTickBudgetSeconds;
+    bool bMoreAssets = true;
+    while (bMoreAssets && !bCancelRequested && FPlatformTime::Seconds() < TickEndTime)
+    {
+        bMoreAssets = Pipeline->Step();
+    }
+
+    if (!bMoreAssets)
+    {
+        Complete(false);
+        return false;
+    }
+
+    UpdateNotification();
+    return true;
+}
+
+void FBPFolderAnalysisJob::Complete(bool bCancelled)
+{
+    TSharedRef<FBPFolderAnalysisJob> KeepAlive = AsShared();
+
+    const int32 NumAssets = GetNumAssets();
+    const FBPProjectAnalysis Analysis = Pipeline->Finish();
+    bRunning = false;
+
+    const double Elapsed = FPlatformTime::Seconds() - StartTime;
+    UE_LOG(LogTemp, Log, TEXT("BlueprintAnalyzer: background analysis of %s %s (%d of %d Blueprints, %.1f s)"),
+        *FolderPath, bCancelled ? TEXT("cancelled") : TEXT("finished"), Analysis.BlueprintsAnalyzed, NumAssets, Elapsed);
+
+    if (Notification.IsValid())
+    {
+        Notification->SetText(FText::FromString(bCancelled
+            ? FString::Printf(TEXT("Blueprint analysis cancelled: %s"), *FolderPath)
+            : FString::Printf(TEXT("Blueprint analysis finished: %s"), *FolderPath)));
+        Notification->SetSubText(FText::FromString(FString::Printf(TEXT("%d of %d Blueprints in %s"),
+            Analysis.BlueprintsAnalyzed, NumAssets, *FText::AsTimespan(FTimespan::FromSeconds(Elapsed)).ToString())));
+        Notification->SetCompletionState(bCancelled ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+        Notification->ExpireAndFadeout();
+        Notification.Reset();
+    }
+
+    FinishedEvent.Broadcast(Analysis, bCancelled);
+    SelfReference.Reset();
+}
+
+void FBPFolderAnalysisJob::ShowNotification()
+{
+    if (!FSlateApplication::IsInitialized()) return;
+
+    FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("Analyzing Blueprints in %s"), *FolderPath)));
+    Info.bFireAndForget = false;
+    Info.bUseThrobber = true;
+    Info.ExpireDuration = 3.0f;
+    Info.SubText = FText::FromString(FString::Printf(TEXT("0 / %d Blueprints"), GetNumAssets()));
+    Info.ButtonDetails.Add(FNotificationButtonInfo(
+        FText::FromString(TEXT("Cancel")),
+        FText::FromString(TEXT("Stop and keep the results gathered so far")),
+        FSimpleDelegate::CreateSP(this, &FBPFolderAnalysisJob::Cancel),
+        SNotificationItem::CS_Pending));
+
+    Notification = FSlateNotificationManager::Get().AddNotification(Info);
+    if (Notification.IsValid())
+    {
+        Notification->SetCompletionState(SNotificationItem::CS_Pending);
+    }
+}
+
+void FBPFolderAnalysisJob::UpdateNotification()
+{
+    if (!Notification.IsValid()) return;
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now - LastNotificationTime < NotificationUpdateSeconds) return;
+    LastNotificationTime = Now;
+
+    FString Progress = FString::Printf(TEXT("%d / %d Blueprints"), GetNumCompleted(), GetNumAssets());
+    const double SecondsRemaining = GetEstimatedSecondsRemaining();
+    if (SecondsRemaining >= 0.0)
+    {
+        Progress += FString::Printf(TEXT(", about %s left"), *FText::AsTimespan(FTimespan::FromSeconds(SecondsRemaining)).ToString());
+    }
+    Notification->SetSubText(FText::FromString(Progress));
+}
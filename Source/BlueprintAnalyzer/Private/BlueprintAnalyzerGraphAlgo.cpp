@@ -0,0 +1,151 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerGraphAlgo.h"
+#include "Algo/Reverse.h"
+
+TArray<TArray<int32>> FBPGraphAlgo::FindStronglyConnectedComponents(
+    TConstArrayView<int32> Offsets,
+    TConstArrayView<int32> Targets,
+    TArray<int32>* OutComponentOf)
+{
+    const int32 NumVertices = Offsets.Num() - 1;
+
+    TArray<TArray<int32>> Components;
+    if (NumVertices <= 0) return Components;
+
+    TArray<int32> Index;
+    TArray<int32> LowLink;
+    TBitArray<> OnStack(false, NumVertices);
+    Index.Init(INDEX_NONE, NumVertices);
+    LowLink.Init(0, NumVertices);
+
+    TArray<int32> SccStack;
+
+    // Explicit DFS frames: vertex + position of the next out-edge to explore
+    struct FFrame
+    {
+        int32 Vertex;
+        int32 NextEdge;
+    };
+    TArray<FFrame> CallStack;
+
+    int32 NextIndex = 0;
+
+    for (int32 Root = 0; Root < NumVertices; ++Root)
+    {
+        if (Index[Root] != INDEX_NONE) continue;
+
+        Index[Root] = LowLink[Root] = NextIndex++;
+        SccStack.Push(Root);
+        OnStack[Root] = true;
+        CallStack.Push({ Root, Offsets[Root] });
+
+        while (CallStack.Num() > 0)
+        {
+            FFrame& Frame = CallStack.Last();
+            const int32 V = Frame.Vertex;
+
+            if (Frame.NextEdge < Offsets[V + 1])
+            {
+                const int32 W = Targets[Frame.NextEdge++];
+                if (Index[W] == INDEX_NONE)
+                {
+                    Index[W] = LowLink[W] = NextIndex++;
+                    SccStack.Push(W);
+                    OnStack[W] = true;
+                    CallStack.Push({ W, Offsets[W] });
+                }
+                else if (OnStack[W])
+                {
+                    LowLink[V] = FMath::Min(LowLink[V], Index[W]);
+                }
+                continue;
+            }
+
+            // All edges of V explored: emit a component if V is its root, then return to the caller
+            if (LowLink[V] == Index[V])
+            {
+                TArray<int32>& Component = Components.AddDefaulted_GetRef();
+                int32 W;
+                do
+                {
+                    W = SccStack.Pop();
+                    OnStack[W] = false;
+                    Component.Add(W);
+                } while (W != V);
+                Component.Sort();
+            }
+
+            CallStack.Pop();
+            if (CallStack.Num() > 0)
+            {
+                const int32 Parent = CallStack.Last().Vertex;
+                LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[V]);
+            }
+        }
+    }
+
+    Components.Sort([](const TArray<int32>& A, const TArray<int32>& B)
+    {
+        return A[0] < B[0];
+    });
+
+    if (OutComponentOf)
+    {
+        OutComponentOf->SetNumUninitialized(NumVertices);
+        for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ++ComponentIndex)
+        {
+            for (int32 Vertex : Components[ComponentIndex])
+            {
+                (*OutComponentOf)[Vertex] = ComponentIndex;
+            }
+        }
+    }
+    return Components;
+}
+
+TArray<int32> FBPGraphAlgo::FindCycleThrough(
+    TConstArrayView<int32> Offsets,
+    TConstArrayView<int32> Targets,
+    TConstArrayView<int32> ComponentOf,
+    int32 Start)
+{
+    TArray<int32> Cycle;
+    if (!ComponentOf.IsValidIndex(Start)) return Cycle;
+
+    const int32 Component = ComponentOf[Start];
+
+    // BFS parent of every reached vertex; keyed so the cost stays proportional to the component
+    TMap<int32, int32> Parent;
+    Parent.Add(Start, INDEX_NONE);
+
+    TArray<int32> Queue;
+    Queue.Add(Start);
+
+    for (int32 Head = 0; Head < Queue.Num(); ++Head)
+    {
+        const int32 V = Queue[Head];
+        for (int32 Edge = Offsets[V]; Edge < Offsets[V + 1]; ++Edge)
+        {
+            const int32 W = Targets[Edge];
+            if (W == Start)
+            {
+                // Walk parents back to Start, then reverse into forward order
+                for (int32 At = V; At != INDEX_NONE; At = Parent[At])
+                {
+                    Cycle.Add(At);
+                }
+                Algo::Reverse(Cycle);
+                return Cycle;
+            }
+
+            if (ComponentOf[W] == Component && !Parent.Contains(W))
+            {
+                Parent.Add(W, V);
+                Queue.Add(W);
+            }
+        }
+    }
+
+    return Cycle;
+}
@@ -0,0 +1,192 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerIncremental.h"
+#include "BlueprintAnalyzerMacroCache.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Misc/DateTime.h"
+
+// Replaces Count elements at Index with Replacement, shifting the tail once
+template<typename ElementType>
+static void SpliceRows(TArray<ElementType>& Rows, int32 Index, int32 Count, TArray<ElementType>&& Replacement)
+{
+    Rows.RemoveAt(Index, Count, EAllowShrinking::No);
+    Rows.Insert(MoveTemp(Replacement), Index);
+}
+
+void FBPIncrementalAnalysis::GatherGraphs(UBlueprint* Blueprint, TArray<TPair<UEdGraph*, EBPGraphKind>>& OutGraphs)
+{
+    OutGraphs.Reset();
+    if (!Blueprint) return;
+
+    auto Add = [&OutGraphs](const TArray<UEdGraph*>& Graphs, EBPGraphKind Kind)
+    {
+        for (UEdGraph* Graph : Graphs)
+        {
+            if (Graph)
+            {
+                OutGraphs.Emplace(Graph, Kind);
+            }
+        }
+    };
+    Add(Blueprint->UbergraphPages, EBPGraphKind::Ubergraph);
+    Add(Blueprint->FunctionGraphs, EBPGraphKind::Function);
+    Add(Blueprint->MacroGraphs, EBPGraphKind::Macro);
+    Add(Blueprint->DelegateSignatureGraphs, EBPGraphKind::DelegateSignature);
+    Add(Blueprint->IntermediateGeneratedGraphs, EBPGraphKind::Intermediate);
+
+    TArray<UEdGraph*> CollapsedGraphs;
+    FBPSnapshotAnalyzer::GatherCollapsedGraphs(Blueprint->UbergraphPages, CollapsedGraphs);
+    FBPSnapshotAnalyzer::GatherCollapsedGraphs(Blueprint->FunctionGraphs, CollapsedGraphs);
+    Add(CollapsedGraphs, EBPGraphKind::Collapsed);
+}
+
+void FBPIncrementalAnalysis::Build(UBlueprint* Blueprint)
+{
+    check(IsInGameThread());
+
+    Slices.Reset();
+    TraceLimits = FBPTraceLimits::FromConsoleVariables();
+    Analysis = FBlueprintAnalysisResult();
+    PerformanceReport = FBPPerformanceReport();
+    if (!Blueprint) return;
+
+    TArray<TPair<UEdGraph*, EBPGraphKind>> Graphs;
+    GatherGraphs(Blueprint, Graphs);
+
+    Slices.Reserve(Graphs.Num());
+    for (const TPair<UEdGraph*, EBPGraphKind>& Graph : Graphs)
+    {
+        FGraphSlice& Slice = Slices.AddDefaulted_GetRef();
+        Slice.Graph = Graph.Key;
+        Slice.Kind = Graph.Value;
+        ExtractSlice(Blueprint, Graphs, Graph.Key, Slice, Analysis.Nodes.Num(), Analysis.Connections.Num(), Analysis.ExecutionPaths.Num(),
+            Analysis.SharedSegments.Num());
+    }
+
+    Finalize(Blueprint);
+}
+
+int32 FBPIncrementalAnalysis::Update(UBlueprint* Blueprint, const TSet<TObjectKey<UEdGraph>>& DirtyGraphs)
+{
+    check(IsInGameThread());
+    if (!Blueprint) return 0;
+
+    TArray<TPair<UEdGraph*, EBPGraphKind>> Graphs;
+    GatherGraphs(Blueprint, Graphs);
+
+    bool bSameGraphs = IsBuilt() && Graphs.Num() == Slices.Num();
+    for (int32 Index = 0; bSameGraphs && Index < Graphs.Num(); ++Index)
+    {
+        bSameGraphs = Slices[Index].Graph == TObjectKey<UEdGraph>(Graphs[Index].Key) && Slices[Index].Kind == Graphs[Index].Value;
+    }
+
+    // Every slice's paths and context graphs depend on the trace limits
+    if (!bSameGraphs || TraceLimits != FBPTraceLimits::FromConsoleVariables())
+    {
+        Build(Blueprint);
+        return Slices.Num();
+    }
+
+    TSet<TObjectKey<UEdGraph>> ChangedGraphs;
+    bool bMacroChanged = false;
+    for (int32 Index = 0; Index < Slices.Num(); ++Index)
+    {
+        if (DirtyGraphs.Contains(Slices[Index].Graph) || Graphs[Index].Key->Nodes.Num() != Slices[Index].TotalNodeCount)
+        {
+            ChangedGraphs.Add(Slices[Index].Graph);
+            bMacroChanged |= Slices[Index].Kind == EBPGraphKind::Macro;
+        }
+    }
+
+    // Instances see a macro body only through its cached summary, so both have to be refreshed
+    const FName PackageName = Blueprint->GetOutermost()->GetFName();
+    if (bMacroChanged)
+    {
+        FBPMacroCache::Get().InvalidateBlueprint(Blueprint);
+    }
+
+    int32 NumExtracted = 0;
+    int32 FirstNode = 0;
+    int32 FirstConnection = 0;
+    int32 FirstPath = 0;
+    int32 FirstSegment = 0;
+    for (int32 Index = 0; Index < Slices.Num(); ++Index)
+    {
+        FGraphSlice& Slice = Slices[Index];
+        const bool bContextChanged = Slice.ContextGraphs.ContainsByPredicate([&ChangedGraphs](const TObjectKey<UEdGraph>& ContextGraph)
+        {
+            return ChangedGraphs.Contains(ContextGraph);
+        });
+        const bool bMacroInstanceChanged = bMacroChanged && Slice.MacroPackages.Contains(PackageName);
+        if (bContextChanged || bMacroInstanceChanged || ChangedGraphs.Contains(Slice.Graph))
+        {
+            ExtractSlice(Blueprint, Graphs, Graphs[Index].Key, Slice, FirstNode, FirstConnection, FirstPath, FirstSegment);
+            ++NumExtracted;
+        }
+
+        FirstNode += Slice.NumNodes;
+        FirstConnection += Slice.NumConnections;
+        FirstPath += Slice.NumPaths;
+        FirstSegment += Slice.NumSegments;
+    }
+
+    // Metadata and the Blueprint-wide perf rules are cheap and may change without any graph edit
+    Finalize(Blueprint);
+    return NumExtracted;
+}
+
+void FBPIncrementalAnalysis::ExtractSlice(UBlueprint* Blueprint, const TArray<TPair<UEdGraph*, EBPGraphKind>>& Graphs, UEdGraph* Graph,
+    FGraphSlice& Slice, int32 FirstNode, int32 FirstConnection, int32 FirstPath, int32 FirstSegment)
+{
+    // Event graphs need their callees for Tick costs and hot loop rules; any graph needs them for call expansion
+    TArray<UEdGraph*> ContextGraphs;
+    const bool bWithContext = Slice.Kind == EBPGraphKind::Ubergraph || TraceLimits.MaxCallDepth > 0;
+    const FBPBlueprintSnapshot Snapshot = bWithContext
+        ? FBPSnapshotAnalyzer::CaptureGraphInContext(Blueprint, Graph, Slice.Kind, Graphs, ContextGraphs)
+        : FBPSnapshotAnalyzer::CaptureGraph(Blueprint, Graph, Slice.Kind);
+
+    FBPPerformanceFacts PerformanceFacts;
+    FBlueprintAnalysisResult GraphResult = FBPSnapshotAnalyzer::BuildAnalysisResult(Snapshot, &PerformanceFacts, TraceLimits);
+
+    const int32 NumNodes = GraphResult.Nodes.Num();
+    const int32 NumConnections = GraphResult.Connections.Num();
+    const int32 NumPaths = GraphResult.ExecutionPaths.Num();
+    const int32 NumSegments = GraphResult.SharedSegments.Num();
+    SpliceRows(Analysis.Nodes, FirstNode, Slice.NumNodes, MoveTemp(GraphResult.Nodes));
+    SpliceRows(Analysis.Connections, FirstConnection, Slice.NumConnections, MoveTemp(GraphResult.Connections));
+    SpliceRows(Analysis.ExecutionPaths, FirstPath, Slice.NumPaths, MoveTemp(GraphResult.ExecutionPaths));
+    SpliceRows(Analysis.SharedSegments, FirstSegment, Slice.NumSegments, MoveTemp(GraphResult.SharedSegments));
+
+    Slice.TotalNodeCount = Graph->Nodes.Num();
+    Slice.NumNodes = NumNodes;
+    Slice.NumConnections = NumConnections;
+    Slice.NumPaths = NumPaths;
+    Slice.NumSegments = NumSegments;
+    Slice.PerformanceFacts = MoveTemp(PerformanceFacts);
+
+    Slice.ContextGraphs.Reset(ContextGraphs.Num());
+    for (UEdGraph* ContextGraph : ContextGraphs)
+    {
+        Slice.ContextGraphs.Add(ContextGraph);
+    }
+    Slice.MacroPackages = Snapshot.GetMacroPackages();
+}
+
+void FBPIncrementalAnalysis::Finalize(UBlueprint* Blueprint)
+{
+    const FString Timestamp = FDateTime::Now().ToString();
+
+    Analysis.BlueprintName = Blueprint->GetName();
+    Analysis.AnalysisTimestamp = Timestamp;
+    Analysis.Metadata = UBlueprintAnalyzerLibrary::ExtractMetadata(Blueprint);
+
+    FBPPerformanceFacts PerformanceFacts;
+    for (const FGraphSlice& Slice : Slices)
+    {
+        PerformanceFacts.Append(Slice.PerformanceFacts);
+    }
+    PerformanceReport.BlueprintName = Analysis.BlueprintName;
+    PerformanceReport.AnalysisTimestamp = Timestamp;
+    FBPSnapshotAnalyzer::ApplyPerformanceRules(PerformanceFacts, PerformanceReport);
+}
@@ -0,0 +1,281 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerIndex.h"
+#include "BlueprintAnalyzerSnapshot.h"
+#include "BlueprintAnalyzerProfiling.h"
+#include "BlueprintAnalyzerStringKeyFuncs.h"
+#include "HAL/FileManager.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "The project index is written in native byte order and defined as little-endian");
+
+// ============================================================
+// FBPIndexRows
+// ============================================================
+
+FBPIndexRows FBPIndexRows::FromSnapshot(const FBPBlueprintSnapshot& Snapshot, const FBPTraceSet& Trace)
+{
+    FBPIndexRows Rows;
+
+    TMap<FString, uint32, FDefaultSetAllocator, TBPCaseSensitiveKeyFuncs<uint32>> StringIds;
+    auto Intern = [&Rows, &StringIds](const FString& Value) -> uint32
+    {
+        if (const uint32* Existing = StringIds.Find(Value))
+        {
+            return *Existing;
+        }
+        const uint32 Id = static_cast<uint32>(Rows.Strings.Add(Value));
+        StringIds.Add(Value, Id);
+        return Id;
+    };
+
+    const int32 NumNodes = Snapshot.Nodes.Num();
+    Rows.NodeType.Reserve(NumNodes);
+    Rows.NodeName.Reserve(NumNodes);
+    Rows.NodeGraph.Reserve(NumNodes);
+    Rows.NodeFlags.Reserve(NumNodes);
+
+    for (const FBPNodeSnapshot& Node : Snapshot.Nodes)
+    {
+        Rows.NodeType.Add(Intern(Node.NodeType));
+        Rows.NodeName.Add(Intern(Node.FunctionName.IsEmpty() ? Node.Title : Node.FunctionName));
+        Rows.NodeGraph.Add(Intern(Snapshot.GetGraph(Node).GraphName));
+
+        uint8 Flags = 0;
+        Flags |= Node.bIsEvent ? BPIndexNode_Event : 0;
+        Flags |= Node.bIsFunctionEntry ? BPIndexNode_FunctionEntry : 0;
+        Flags |= Node.bIsTickEvent ? BPIndexNode_Tick : 0;
+        Flags |= Node.bIsBeginPlayEvent ? BPIndexNode_BeginPlay : 0;
+        Flags |= Node.bIsLatent ? BPIndexNode_Latent : 0;
+        Rows.NodeFlags.Add(Flags);
+    }
+
+    // A path reaches its own steps plus every shared segment it references, directly or through another segment
+    TBitArray<> SegmentReached;
+    TArray<const FBPTracePath*> PendingPaths;
+    for (const FBPTracePath& Path : Trace.Paths)
+    {
+        SegmentReached.Init(false, Trace.Segments.Num());
+        PendingPaths.Reset();
+        PendingPaths.Add(&Path);
+        while (PendingPaths.Num() > 0)
+        {
+            for (const FBPTraceStep& Step : Trace.GetSteps(*PendingPaths.Pop(EAllowShrinking::No)))
+            {
+                if (Step.SegmentIndex != INDEX_NONE && !SegmentReached[Step.SegmentIndex])
+                {
+                    SegmentReached[Step.SegmentIndex] = true;
+                    PendingPaths.Add(&Trace.Segments[Step.SegmentIndex]);
+                }
+                if (Step.bIsTerminator) continue;
+
+                Rows.ReachNode.Add(static_cast<uint32>(Step.NodeIndex));
+                Rows.ReachEntry.Add(static_cast<uint32>(Path.EntryNode));
+            }
+        }
+    }
+
+    return Rows;
+}
+
+FArchive& operator<<(FArchive& Ar, FBPIndexRows& Rows)
+{
+    Ar << Rows.Strings;
+    Ar << Rows.NodeType;
+    Ar << Rows.NodeName;
+    Ar << Rows.NodeGraph;
+    Ar << Rows.NodeFlags;
+    Ar << Rows.ReachNode;
+    Ar << Rows.ReachEntry;
+    return Ar;
+}
+
+// ============================================================
+// FBPProjectIndexWriter
+// ============================================================
+
+uint32 FBPProjectIndexWriter::InternString(const FString& Value)
+{
+    if (const uint32* Existing = StringIds.Find(Value))
+    {
+        return *Existing;
+    }
+    const uint32 Id = static_cast<uint32>(Strings.Add(Value));
+    StringIds.Add(Value, Id);
+    return Id;
+}
+
+void FBPProjectIndexWriter::AddBlueprint(const FBPBlueprintSummary& Summary, const FBPIndexRows& Rows, const TArray<FBPDependency>& Dependencies)
+{
+    FBPIndexBlueprintRecord& Record = Blueprints.AddDefaulted_GetRef();
+    Record.Path = InternString(Summary.BlueprintPath);
+    Record.Name = InternString(Summary.BlueprintName);
+    Record.Type = InternString(Summary.BlueprintType);
+    Record.ParentClass = InternString(Summary.ParentClass);
+    Record.PerformanceScore = Summary.PerformanceScore;
+    Record.EstimatedTokenCount = Summary.EstimatedTokenCount;
+
+    TArray<uint32> GlobalIds;
+    GlobalIds.Reserve(Rows.Strings.Num());
+    for (const FString& Value : Rows.Strings)
+    {
+        GlobalIds.Add(InternString(Value));
+    }
+
+    const int32 NumNodes = Rows.NodeType.Num();
+    const bool bNodesValid = Rows.NodeName.Num() == NumNodes && Rows.NodeGraph.Num() == NumNodes && Rows.NodeFlags.Num() == NumNodes
+        && Rows.ReachNode.Num() == Rows.ReachEntry.Num();
+    if (!bNodesValid)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: inconsistent index rows for %s; indexing its dependencies only"), *Summary.BlueprintPath);
+    }
+
+    Record.FirstNode = static_cast<uint32>(NodeType.Num());
+    Record.FirstReach = static_cast<uint32>(ReachNode.Num());
+    if (bNodesValid)
+    {
+        for (int32 Row = 0; Row < NumNodes; ++Row)
+        {
+            NodeType.Add(GlobalIds[Rows.NodeType[Row]]);
+            NodeName.Add(GlobalIds[Rows.NodeName[Row]]);
+            NodeGraph.Add(GlobalIds[Rows.NodeGraph[Row]]);
+        }
+        NodeFlags.Append(Rows.NodeFlags);
+
+        for (int32 Row = 0; Row < Rows.ReachNode.Num(); ++Row)
+        {
+            ReachNode.Add(Record.FirstNode + Rows.ReachNode[Row]);
+            ReachEntry.Add(Record.FirstNode + Rows.ReachEntry[Row]);
+        }
+        Record.NumNodes = static_cast<uint32>(NumNodes);
+        Record.NumReach = static_cast<uint32>(Rows.ReachNode.Num());
+    }
+
+    Record.FirstDependency = static_cast<uint32>(DepClass.Num());
+    Record.NumDependencies = static_cast<uint32>(Dependencies.Num());
+    for (const FBPDependency& Dependency : Dependencies)
+    {
+        DepClass.Add(InternString(Dependency.ReferencedClass));
+        DepType.Add(InternString(Dependency.ReferenceType));
+        DepGraph.Add(InternString(Dependency.GraphName));
+    }
+}
+
+template<typename ElementType>
+static void WriteSection(FArchive& Ar, FBPIndexHeader& Header, EBPIndexSection Section, TArray<ElementType>& Column)
+{
+    // Pad to 8 bytes so every column can be viewed in place from a mapped file
+    static const uint8 Padding[8] = {};
+    const int64 Misalignment = Ar.Tell() % 8;
+    if (Misalignment != 0)
+    {
+        Ar.Serialize(const_cast<uint8*>(Padding), 8 - Misalignment);
+    }
+
+    Header.SectionOffsets[(int32)Section] = static_cast<uint64>(Ar.Tell());
+    Ar.Serialize(Column.GetData(), Column.Num() * sizeof(ElementType));
+}
+
+bool FBPProjectIndexWriter::Save(const FString& FilePath)
+{
+    BPA_STAGE_SCOPE(ExportIndex);
+
+    // Sort the string table bytewise by UTF-8 so readers can binary search it, then renumber
+    TArray<TArray<ANSICHAR>> Encoded;
+    Encoded.Reserve(Strings.Num());
+    for (const FString& Value : Strings)
+    {
+        FTCHARToUTF8 Utf8(*Value, Value.Len());
+        Encoded.Emplace((const ANSICHAR*)Utf8.Get(), Utf8.Length());
+    }
+
+    TArray<uint32> Order;
+    Order.SetNumUninitialized(Strings.Num());
+    for (int32 Index = 0; Index < Order.Num(); ++Index)
+    {
+        Order[Index] = static_cast<uint32>(Index);
+    }
+    Order.Sort([&Encoded](uint32 A, uint32 B)
+    {
+        const TArray<ANSICHAR>& Left = Encoded[A];
+        const TArray<ANSICHAR>& Right = Encoded[B];
+        const int32 Compare = FMemory::Memcmp(Left.GetData(), Right.GetData(), FMath::Min(Left.Num(), Right.Num()));
+        return Compare != 0 ? Compare < 0 : Left.Num() < Right.Num();
+    });
+
+    TArray<uint32> NewIds;
+    NewIds.SetNumUninitialized(Order.Num());
+    for (int32 Index = 0; Index < Order.Num(); ++Index)
+    {
+        NewIds[Order[Index]] = static_cast<uint32>(Index);
+    }
+
+    for (FBPIndexBlueprintRecord& Record : Blueprints)
+    {
+        Record.Path = NewIds[Record.Path];
+        Record.Name = NewIds[Record.Name];
+        Record.Type = NewIds[Record.Type];
+        Record.ParentClass = NewIds[Record.ParentClass];
+    }
+    for (TArray<uint32>* Column : { &NodeType, &NodeName, &NodeGraph, &DepClass, &DepType, &DepGraph })
+    {
+        for (uint32& Id : *Column)
+        {
+            Id = NewIds[Id];
+        }
+    }
+
+    TArray<uint32> StringOffsets;
+    TArray<ANSICHAR> StringData;
+    StringOffsets.Reserve(Order.Num() + 1);
+    for (const uint32 Id : Order)
+    {
+        if (StringData.Num() + Encoded[Id].Num() + 1 > MAX_int32)
+        {
+            UE_LOG(LogTemp, Error, TEXT("BlueprintAnalyzer: project index string table exceeds 2 GB"));
+            return false;
+        }
+        StringOffsets.Add(static_cast<uint32>(StringData.Num()));
+        StringData.Append(Encoded[Id]);
+        StringData.Add('\0');
+    }
+    StringOffsets.Add(static_cast<uint32>(StringData.Num()));
+
+    TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!FileWriter)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: could not open %s for writing"), *FilePath);
+        return false;
+    }
+
+    FBPIndexHeader Header;
+    Header.NumBlueprints = static_cast<uint32>(Blueprints.Num());
+    Header.NumNodes = static_cast<uint32>(NodeType.Num());
+    Header.NumReach = static_cast<uint32>(ReachNode.Num());
+    Header.NumDependencies = static_cast<uint32>(DepClass.Num());
+    Header.NumStrings = static_cast<uint32>(Order.Num());
+
+    // Placeholder; rewritten once the section offsets are known
+    FileWriter->Serialize(&Header, sizeof(Header));
+
+    WriteSection(*FileWriter, Header, EBPIndexSection::Blueprints, Blueprints);
+    WriteSection(*FileWriter, Header, EBPIndexSection::NodeType, NodeType);
+    WriteSection(*FileWriter, Header, EBPIndexSection::NodeName, NodeName);
+    WriteSection(*FileWriter, Header, EBPIndexSection::NodeGraph, NodeGraph);
+    WriteSection(*FileWriter, Header, EBPIndexSection::NodeFlags, NodeFlags);
+    WriteSection(*FileWriter, Header, EBPIndexSection::ReachNode, ReachNode);
+    WriteSection(*FileWriter, Header, EBPIndexSection::ReachEntry, ReachEntry);
+    WriteSection(*FileWriter, Header, EBPIndexSection::DepClass, DepClass);
+    WriteSection(*FileWriter, Header, EBPIndexSection::DepType, DepType);
+    WriteSection(*FileWriter, Header, EBPIndexSection::DepGraph, DepGraph);
+    WriteSection(*FileWriter, Header, EBPIndexSection::StringOffsets, StringOffsets);
+    WriteSection(*FileWriter, Header, EBPIndexSection::StringData, StringData);
+
+    Header.FileSize = static_cast<uint64>(FileWriter->Tell());
+    FileWriter->Seek(0);
+    FileWriter->Serialize(&Header, sizeof(Header));
+
+    const bool bOk = FileWriter->Close();
+    UE_LOG(LogTemp, Log, TEXT("BlueprintAnalyzer: project index %s: %u Blueprints, %u nodes, %u dependencies, %u strings, %llu bytes"),
+        *FilePath, Header.NumBlueprints, Header.NumNodes, Header.NumDependencies, Header.NumStrings, Header.FileSize);
+    return bOk;
+}
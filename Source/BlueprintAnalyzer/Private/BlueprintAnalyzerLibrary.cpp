@@ -1,6 +1,13 @@
 // Copyright (c) 2025 keemminxu. All Rights Reserved.
 
 #include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerSnapshot.h"
+#include "BlueprintAnalyzerPipeline.h"
+#include "BlueprintAnalyzerCache.h"
+#include "BlueprintAnalyzerRegistryScan.h"
+#include "BlueprintAnalyzerGraphAlgo.h"
+#include "BlueprintAnalyzerProfiling.h"
+#include "BlueprintAnalyzerBinaryFormat.h"
 #include "K2Node.h"
 #include "K2Node_Event.h"
 #include "K2Node_CustomEvent.h"
@@ -18,7 +25,6 @@
 #include "K2Node_Knot.h"
 #include "K2Node_Composite.h"
 #include "EdGraph/EdGraphPin.h"
-#include "EdGraphNode_Comment.h"
 #include "EdGraph/EdGraphSchema.h"
 #include "EdGraphSchema_K2.h"
 #include "Engine/Blueprint.h"
@@ -26,9 +32,8 @@
 #include "Engine/SCS_Node.h"
 #include "Engine/InheritableComponentHandler.h"
 #include "Engine/TimelineTemplate.h"
-#include "Dom/JsonObject.h"
-#include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/DateTime.h"
 #include "UObject/UnrealType.h"
@@ -56,148 +61,60 @@
 #include "AssetRegistry/IAssetRegistry.h"
 
 // Forward declarations for file-local static helpers (used across sections)
-static TArray<TSharedPtr<FJsonValue>> StringArrayToJson(const TArray<FString>& InArray);
-static TArray<TSharedPtr<FJsonValue>> ParamsToJson(const TArray<FBPFunctionParam>& Params);
-static TSharedPtr<FJsonObject> MetadataToJson(const FBPAnalyzerMetadata& Meta);
-
-// Original Blueprint Analysis Functions Implementation
-FBlueprintAnalysisResult UBlueprintAnalyzerLibrary::AnalyzeBlueprint(UBlueprint* Blueprint)
+template<typename JsonWriterType> static void WriteStringArrayJson(JsonWriterType& Writer, const TCHAR* Identifier, const TArray<FString>& InArray);
+template<typename JsonWriterType> static void WriteParamsJson(JsonWriterType& Writer, const TArray<FBPFunctionParam>& Params);
+template<typename JsonWriterType> static void WriteMetadataJson(JsonWriterType& Writer, const FBPAnalyzerMetadata& Meta);
+template<typename JsonWriterType> static void WriteStageTimingsJson(JsonWriterType& Writer, const TArray<FBPStageTiming>& Timings);
+
+// JSON exports stream straight through a TJsonWriter instead of building an FJsonObject DOM.
+// The same writer bodies serve both the FString exports and the Save*ToFile functions, which
+// write through a file archive so peak memory does not grow with the export size.
+template<typename WriteBodyType>
+static FString WriteJsonToString(WriteBodyType&& WriteBody)
 {
-    FBlueprintAnalysisResult Result;
-
-    if (!Blueprint)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Blueprint is null"));
-        return Result;
-    }
-
-    Result.BlueprintName = Blueprint->GetName();
-    Result.AnalysisTimestamp = FDateTime::Now().ToString();
-    Result.Metadata = ExtractMetadata(Blueprint);
-
-    auto ProcessGraphs = [&Result](const TArray<UEdGraph*>& Graphs)
-    {
-        for (UEdGraph* Graph : Graphs)
-        {
-            if (!Graph) continue;
+    BPA_STAGE_SCOPE(ExportJSON);
 
-            const FString GraphName = Graph->GetName();
-            for (UEdGraphNode* GraphNode : Graph->Nodes)
-            {
-                if (UK2Node* K2Node = Cast<UK2Node>(GraphNode))
-                {
-                    FBlueprintNodeInfo NodeInfo = ExtractNodeInfo(K2Node);
-                    NodeInfo.GraphName = GraphName;
-                    NodeInfo.CommentGroup = FindCommentGroupForNode(K2Node, Graph);
-                    Result.Nodes.Add(NodeInfo);
-                }
-            }
-
-            Result.Connections.Append(ExtractConnections(Graph));
-        }
-    };
-
-    ProcessGraphs(Blueprint->UbergraphPages);
-    ProcessGraphs(Blueprint->FunctionGraphs);
-    ProcessGraphs(Blueprint->MacroGraphs);
-    ProcessGraphs(Blueprint->DelegateSignatureGraphs);
-    ProcessGraphs(Blueprint->IntermediateGeneratedGraphs);
-
-    Result.ExecutionPaths = TraceExecutionPaths(Blueprint);
-
-    return Result;
+    FString Out;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
+    WriteBody(*Writer);
+    Writer->Close();
+    return Out;
 }
 
-FBlueprintNodeInfo UBlueprintAnalyzerLibrary::ExtractNodeInfo(UK2Node* Node)
+template<typename WriteBodyType>
+static bool WriteJsonToFile(const FString& FilePath, WriteBodyType&& WriteBody)
 {
-    FBlueprintNodeInfo NodeInfo;
-
-    if (!Node) return NodeInfo;
-
-    NodeInfo.NodeGuid = Node->NodeGuid.ToString();
-    NodeInfo.NodeType = GetNodeTypeName(Node);
-    NodeInfo.NodeName = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-
-    if (UK2Node_CallFunction* CallFunctionNode = Cast<UK2Node_CallFunction>(Node))
-    {
-        if (CallFunctionNode->GetTargetFunction())
-        {
-            NodeInfo.FunctionName = CallFunctionNode->GetTargetFunction()->GetName();
-        }
-    }
-    else if (UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(Node))
-    {
-        if (CastNode->TargetType)
-        {
-            NodeInfo.FunctionName = CastNode->TargetType->GetName();
-        }
-    }
-    else if (UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
-    {
-        if (UEdGraph* MacroGraph = MacroNode->GetMacroGraph())
-        {
-            NodeInfo.FunctionName = MacroGraph->GetName();
-        }
-    }
+    BPA_STAGE_SCOPE(ExportJSON);
 
-    for (UEdGraphPin* Pin : Node->Pins)
+    TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!FileWriter)
     {
-        const FString PinEntry = FString::Printf(TEXT("%s:%s"),
-            *Pin->PinName.ToString(),
-            *GetPinTypeString(Pin->PinType));
-
-        if (Pin->Direction == EGPD_Input)
-        {
-            NodeInfo.InputPins.Add(PinEntry);
-
-            const FString Literal = ExtractLiteralFromPin(Pin);
-            if (!Literal.IsEmpty())
-            {
-                NodeInfo.LiteralValues.Add(FString::Printf(TEXT("%s=%s"), *Pin->PinName.ToString(), *Literal));
-            }
-        }
-        else if (Pin->Direction == EGPD_Output)
-        {
-            NodeInfo.OutputPins.Add(PinEntry);
-        }
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: could not open %s for writing"), *FilePath);
+        return false;
     }
 
-    return NodeInfo;
+    TSharedRef<TJsonWriter<UTF8CHAR>> Writer = TJsonWriterFactory<UTF8CHAR>::Create(FileWriter.Get());
+    WriteBody(*Writer);
+    Writer->Close();
+    return FileWriter->Close();
 }
 
-TArray<FBlueprintConnectionInfo> UBlueprintAnalyzerLibrary::ExtractConnections(UEdGraph* Graph)
+static const TCHAR* PerformanceSeverityToString(EBPPerformanceSeverity Severity)
 {
-    TArray<FBlueprintConnectionInfo> Connections;
-    
-    if (!Graph) return Connections;
+    return Severity == EBPPerformanceSeverity::Critical ? TEXT("Critical") :
+           Severity == EBPPerformanceSeverity::Warning ? TEXT("Warning") : TEXT("Info");
+}
 
-    for (UEdGraphNode* GraphNode : Graph->Nodes)
+// Original Blueprint Analysis Functions Implementation
+FBlueprintAnalysisResult UBlueprintAnalyzerLibrary::AnalyzeBlueprint(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
     {
-        UK2Node* K2Node = Cast<UK2Node>(GraphNode);
-        if (!K2Node) continue;
-
-        for (UEdGraphPin* Pin : K2Node->Pins)
-        {
-            if (Pin->Direction == EGPD_Output && Pin->LinkedTo.Num() > 0)
-            {
-                for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-                {
-                    if (LinkedPin && LinkedPin->GetOwningNode())
-                    {
-                        FBlueprintConnectionInfo ConnectionInfo;
-                        ConnectionInfo.FromNodeGuid = K2Node->NodeGuid.ToString();
-                        ConnectionInfo.FromPinName = Pin->PinName.ToString();
-                        ConnectionInfo.ToNodeGuid = LinkedPin->GetOwningNode()->NodeGuid.ToString();
-                        ConnectionInfo.ToPinName = LinkedPin->PinName.ToString();
-                        
-                        Connections.Add(ConnectionInfo);
-                    }
-                }
-            }
-        }
+        UE_LOG(LogTemp, Warning, TEXT("Blueprint is null"));
+        return FBlueprintAnalysisResult();
     }
 
-    return Connections;
+    return FBPSnapshotAnalyzer::BuildAnalysisResult(FBPSnapshotAnalyzer::Capture(Blueprint));
 }
 
 FString UBlueprintAnalyzerLibrary::GetNodeTypeName(UK2Node* Node)
@@ -289,34 +206,6 @@ FString UBlueprintAnalyzerLibrary::ExtractLiteralFromPin(const UEdGraphPin* Pin)
     return FString();
 }
 
-FString UBlueprintAnalyzerLibrary::FindCommentGroupForNode(const UEdGraphNode* Node, const UEdGraph* Graph)
-{
-    if (!Node || !Graph) return FString();
-
-    const float NodeLeft = Node->NodePosX;
-    const float NodeTop = Node->NodePosY;
-    const float NodeRight = NodeLeft + FMath::Max(Node->NodeWidth, 100);
-    const float NodeBottom = NodeTop + FMath::Max(Node->NodeHeight, 50);
-
-    for (UEdGraphNode* OtherNode : Graph->Nodes)
-    {
-        const UEdGraphNode_Comment* Comment = Cast<UEdGraphNode_Comment>(OtherNode);
-        if (!Comment) continue;
-
-        const float CL = Comment->NodePosX;
-        const float CT = Comment->NodePosY;
-        const float CR = CL + FMath::Max(Comment->NodeWidth, 0);
-        const float CB = CT + FMath::Max(Comment->NodeHeight, 0);
-
-        if (NodeLeft >= CL && NodeRight <= CR && NodeTop >= CT && NodeBottom <= CB)
-        {
-            return Comment->NodeComment;
-        }
-    }
-
-    return FString();
-}
-
 FString UBlueprintAnalyzerLibrary::GetBlueprintTypeString(UBlueprint* Blueprint)
 {
     if (!Blueprint) return TEXT("Unknown");
@@ -345,6 +234,8 @@ FString UBlueprintAnalyzerLibrary::GetBlueprintTypeString(UBlueprint* Blueprint)
 
 FBPAnalyzerMetadata UBlueprintAnalyzerLibrary::ExtractMetadata(UBlueprint* Blueprint)
 {
+    BPA_STAGE_SCOPE(Metadata);
+
     FBPAnalyzerMetadata Metadata;
     if (!Blueprint) return Metadata;
 
@@ -523,440 +414,102 @@ FBPAnalyzerMetadata UBlueprintAnalyzerLibrary::ExtractMetadata(UBlueprint* Bluep
     return Metadata;
 }
 
-// ============================================================
-// Phase 2: Execution Flow Tracing
-// ============================================================
-
-FString UBlueprintAnalyzerLibrary::GetExecutionStepSummary(UK2Node* Node)
-{
-    if (!Node) return TEXT("");
-
-    const FString Title = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-    const FString TypeName = GetNodeTypeName(Node);
-
-    if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
-    {
-        if (CallNode->GetTargetFunction())
-        {
-            return FString::Printf(TEXT("%s(...)"), *CallNode->GetTargetFunction()->GetName());
-        }
-    }
-    if (UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(Node))
-    {
-        if (CastNode->TargetType)
-        {
-            return FString::Printf(TEXT("Cast<%s>"), *CastNode->TargetType->GetName());
-        }
-    }
-    if (UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
-    {
-        if (UEdGraph* MacroGraph = MacroNode->GetMacroGraph())
-        {
-            return FString::Printf(TEXT("Macro: %s"), *MacroGraph->GetName());
-        }
-    }
-
-    return FString::Printf(TEXT("%s (%s)"), *TypeName, *Title);
-}
-
-void UBlueprintAnalyzerLibrary::TraceFromNode(
-    UK2Node* StartNode,
-    int32 Depth,
-    const FString& BranchLabel,
-    TArray<FExecutionStep>& OutSteps,
-    TSet<FGuid>& VisitedNodes)
-{
-    // Safety: depth cap and cycle guard
-    const int32 MaxDepth = 64;
-    const int32 MaxSteps = 512;
-    if (!StartNode || Depth > MaxDepth || OutSteps.Num() > MaxSteps) return;
-
-    UK2Node* Current = StartNode;
-    int32 CurrentDepth = Depth;
-    FString CurrentLabel = BranchLabel;
-
-    while (Current)
-    {
-        if (OutSteps.Num() > MaxSteps) return;
-
-        // Cycle detection — if we've already visited this node, add a marker and stop
-        if (VisitedNodes.Contains(Current->NodeGuid))
-        {
-            FExecutionStep Step;
-            Step.NodeGuid = Current->NodeGuid.ToString();
-            Step.NodeType = TEXT("Loopback");
-            Step.Summary = FString::Printf(TEXT("-> back to %s"), *GetExecutionStepSummary(Current));
-            Step.BranchLabel = CurrentLabel;
-            Step.Depth = CurrentDepth;
-            Step.bIsTerminator = true;
-            OutSteps.Add(Step);
-            return;
-        }
-        VisitedNodes.Add(Current->NodeGuid);
-
-        // Record this step
-        FExecutionStep Step;
-        Step.NodeGuid = Current->NodeGuid.ToString();
-        Step.NodeType = GetNodeTypeName(Current);
-        Step.Summary = GetExecutionStepSummary(Current);
-        Step.BranchLabel = CurrentLabel;
-        Step.Depth = CurrentDepth;
-
-        // Latent node detection: CallFunction flagged with MD_Latent metadata
-        if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Current))
-        {
-            if (UFunction* Fn = CallNode->GetTargetFunction())
-            {
-                Step.bIsLatent = Fn->HasMetaData(FBlueprintMetadata::MD_Latent);
-            }
-        }
-
-        OutSteps.Add(Step);
-        CurrentLabel.Reset();
-
-        // Branch handling: Branch (IfThenElse), Sequence, Cast with success/fail
-        if (UK2Node_IfThenElse* BranchNode = Cast<UK2Node_IfThenElse>(Current))
-        {
-            UEdGraphPin* ThenPin = BranchNode->GetThenPin();
-            UEdGraphPin* ElsePin = BranchNode->GetElsePin();
-            if (ThenPin && ThenPin->LinkedTo.Num() > 0)
-            {
-                for (UEdGraphPin* Linked : ThenPin->LinkedTo)
-                {
-                    if (UK2Node* NextNode = Cast<UK2Node>(Linked->GetOwningNode()))
-                    {
-                        TraceFromNode(NextNode, CurrentDepth + 1, TEXT("True"), OutSteps, VisitedNodes);
-                    }
-                }
-            }
-            if (ElsePin && ElsePin->LinkedTo.Num() > 0)
-            {
-                for (UEdGraphPin* Linked : ElsePin->LinkedTo)
-                {
-                    if (UK2Node* NextNode = Cast<UK2Node>(Linked->GetOwningNode()))
-                    {
-                        TraceFromNode(NextNode, CurrentDepth + 1, TEXT("False"), OutSteps, VisitedNodes);
-                    }
-                }
-            }
-            return;
-        }
-
-        if (UK2Node_ExecutionSequence* SequenceNode = Cast<UK2Node_ExecutionSequence>(Current))
-        {
-            int32 BranchIdx = 0;
-            for (UEdGraphPin* Pin : SequenceNode->Pins)
-            {
-                if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
-                {
-                    for (UEdGraphPin* Linked : Pin->LinkedTo)
-                    {
-                        if (UK2Node* NextNode = Cast<UK2Node>(Linked->GetOwningNode()))
-                        {
-                            TraceFromNode(NextNode, CurrentDepth + 1, FString::Printf(TEXT("Then %d"), BranchIdx), OutSteps, VisitedNodes);
-                        }
-                    }
-                    BranchIdx++;
-                }
-            }
-            return;
-        }
-
-        // Default: follow the single "then" exec output
-        UK2Node* NextInChain = nullptr;
-        for (UEdGraphPin* Pin : Current->Pins)
-        {
-            if (Pin->Direction == EGPD_Output &&
-                Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec &&
-                Pin->LinkedTo.Num() > 0)
-            {
-                // Use the first linked node as the next in chain
-                if (UEdGraphPin* Linked = Pin->LinkedTo[0])
-                {
-                    NextInChain = Cast<UK2Node>(Linked->GetOwningNode());
-
-                    // If this node has multiple exec outputs (e.g., SpawnActor success/fail, Cast), branch them
-                    if (Pin->LinkedTo.Num() > 1)
-                    {
-                        for (int32 i = 1; i < Pin->LinkedTo.Num(); ++i)
-                        {
-                            if (UEdGraphPin* OtherLinked = Pin->LinkedTo[i])
-                            {
-                                if (UK2Node* OtherNode = Cast<UK2Node>(OtherLinked->GetOwningNode()))
-                                {
-                                    TraceFromNode(OtherNode, CurrentDepth + 1, Pin->PinName.ToString(), OutSteps, VisitedNodes);
-                                }
-                            }
-                        }
-                    }
-                }
-                break;
-            }
-        }
-
-        Current = NextInChain;
-    }
-}
-
 // ============================================================
 // Phase 3: Blueprint Performance Analysis
 // ============================================================
 
-// Helper: identify Tick / BeginPlay entry points
-static bool IsTickEvent(UK2Node* Node)
-{
-    if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
-    {
-        const FString Name = EventNode->EventReference.GetMemberName().ToString();
-        return Name.Equals(TEXT("ReceiveTick"), ESearchCase::IgnoreCase) ||
-               Name.Equals(TEXT("Tick"), ESearchCase::IgnoreCase);
-    }
-    return false;
-}
-
-static bool IsBeginPlayEvent(UK2Node* Node)
-{
-    if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
-    {
-        const FString Name = EventNode->EventReference.GetMemberName().ToString();
-        return Name.Equals(TEXT("ReceiveBeginPlay"), ESearchCase::IgnoreCase) ||
-               Name.Equals(TEXT("BeginPlay"), ESearchCase::IgnoreCase);
-    }
-    return false;
-}
-
-// Walks exec-flow downstream from an event node and collects every reachable K2Node
-static void CollectReachableNodes(UK2Node* Start, TSet<UK2Node*>& OutVisited)
+FBPPerformanceReport UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(UBlueprint* Blueprint)
 {
-    if (!Start || OutVisited.Contains(Start)) return;
-
-    TArray<UK2Node*> Stack;
-    Stack.Push(Start);
+    if (!Blueprint) return FBPPerformanceReport();
 
-    while (Stack.Num() > 0)
+    if (const FBPAnalysisCacheEntry* Cached = FBPAnalysisCache::Get().FindForBlueprint(Blueprint))
     {
-        UK2Node* Current = Stack.Pop();
-        if (!Current || OutVisited.Contains(Current)) continue;
-        OutVisited.Add(Current);
-
-        for (UEdGraphPin* Pin : Current->Pins)
-        {
-            if (Pin->Direction == EGPD_Output &&
-                Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
-            {
-                for (UEdGraphPin* Linked : Pin->LinkedTo)
-                {
-                    if (UK2Node* NextNode = Cast<UK2Node>(Linked->GetOwningNode()))
-                    {
-                        Stack.Push(NextNode);
-                    }
-                }
-            }
-        }
+        return Cached->PerformanceReport;
     }
-}
 
-// Detect expensive function calls that are known performance anti-patterns
-static bool IsExpensiveFunctionCall(UK2Node_CallFunction* CallNode, FString& OutFunctionName)
-{
-    if (!CallNode || !CallNode->GetTargetFunction()) return false;
+    const FBPStageProfiler::FRun StageRun;
 
-    const FString FuncName = CallNode->GetTargetFunction()->GetName();
-    OutFunctionName = FuncName;
+    FBPPerformanceReport Report = FBPSnapshotAnalyzer::AnalyzePerformance(FBPSnapshotAnalyzer::Capture(Blueprint));
 
-    static const TArray<FString> ExpensiveFunctions = {
-        TEXT("GetAllActorsOfClass"),
-        TEXT("GetAllActorsWithInterface"),
-        TEXT("GetAllActorsWithTag"),
-        TEXT("GetAllWidgetsOfClass"),
-        TEXT("LineTraceSingle"),
-        TEXT("LineTraceMulti"),
-        TEXT("SphereTraceSingle"),
-        TEXT("SphereTraceMulti"),
-    };
-
-    for (const FString& Expensive : ExpensiveFunctions)
+    if (FBPStageProfiler::IsEnabled())
     {
-        if (FuncName.Contains(Expensive)) return true;
+        Report.StageTimings = StageRun.GetTimings();
     }
-
-    return false;
+    return Report;
 }
 
-FBPPerformanceReport UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(UBlueprint* Blueprint)
+template<typename JsonWriterType>
+static void WritePerformanceReportJson(JsonWriterType& Writer, const FBPPerformanceReport& Report)
 {
-    FBPPerformanceReport Report;
-    if (!Blueprint) return Report;
-
-    Report.BlueprintName = Blueprint->GetName();
-    Report.AnalysisTimestamp = FDateTime::Now().ToString();
-
-    // Collect all event graph nodes
-    TArray<UK2Node*> AllNodes;
-    for (UEdGraph* Graph : Blueprint->UbergraphPages)
-    {
-        if (!Graph) continue;
-        for (UEdGraphNode* GraphNode : Graph->Nodes)
-        {
-            if (UK2Node* K2Node = Cast<UK2Node>(GraphNode))
-            {
-                AllNodes.Add(K2Node);
-            }
-        }
-    }
-    Report.TotalNodes = AllNodes.Num();
-
-    // Gather nodes reachable from Tick/BeginPlay
-    TSet<UK2Node*> TickNodes;
-    TSet<UK2Node*> BeginPlayNodes;
-    for (UK2Node* Node : AllNodes)
-    {
-        if (IsTickEvent(Node))
-        {
-            CollectReachableNodes(Node, TickNodes);
-        }
-        else if (IsBeginPlayEvent(Node))
-        {
-            CollectReachableNodes(Node, BeginPlayNodes);
-        }
-        if (Node->IsA<UK2Node_Event>() || Node->IsA<UK2Node_CustomEvent>())
-        {
-            Report.EventCount++;
-        }
-        if (Node->IsA<UK2Node_DynamicCast>())
-        {
-            Report.CastCount++;
-        }
-    }
-    Report.TickNodeCount = TickNodes.Num();
-    Report.BeginPlayNodeCount = BeginPlayNodes.Num();
-
-    // Rule 1: expensive calls inside Tick (-25 each, cap at 3)
-    int32 TickExpensiveCount = 0;
-    for (UK2Node* Node : TickNodes)
-    {
-        if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
-        {
-            FString FuncName;
-            if (IsExpensiveFunctionCall(CallNode, FuncName))
-            {
-                FBPPerformanceIssue Issue;
-                Issue.IssueType = TEXT("Expensive Call in Tick");
-                Issue.Description = FString::Printf(TEXT("'%s' is called every frame inside Tick"), *FuncName);
-                Issue.Recommendation = TEXT("Cache the result in BeginPlay, use a timer, or event-driven alternative (-25 points)");
-                Issue.Severity = EBPPerformanceSeverity::Critical;
-                Issue.NodeGuid = Node->NodeGuid.ToString();
-                Issue.Deduction = 25;
-                if (UEdGraph* G = Node->GetGraph()) Issue.GraphName = G->GetName();
-                Report.Issues.Add(Issue);
-                if (++TickExpensiveCount >= 3) break;
-            }
-        }
-    }
-
-    // Rule 2: Cast node inside Tick (-10 each, cap at 3)
-    int32 TickCastCount = 0;
-    for (UK2Node* Node : TickNodes)
+    Writer.WriteObjectStart();
+    Writer.WriteValue(TEXT("BlueprintName"), Report.BlueprintName);
+    Writer.WriteValue(TEXT("AnalysisTimestamp"), Report.AnalysisTimestamp);
+    Writer.WriteValue(TEXT("TotalNodes"), Report.TotalNodes);
+    Writer.WriteValue(TEXT("EventCount"), Report.EventCount);
+    Writer.WriteValue(TEXT("CastCount"), Report.CastCount);
+    Writer.WriteValue(TEXT("TickNodeCount"), Report.TickNodeCount);
+    Writer.WriteValue(TEXT("BeginPlayNodeCount"), Report.BeginPlayNodeCount);
+    Writer.WriteValue(TEXT("EstimatedTickCost"), static_cast<double>(Report.EstimatedTickCost));
+    Writer.WriteValue(TEXT("PerformanceScore"), Report.PerformanceScore);
+
+    Writer.WriteArrayStart(TEXT("TickPathCosts"));
+    for (const FBPTickPathCost& PathCost : Report.TickPathCosts)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("EntryPointName"), PathCost.EntryPointName);
+        Writer.WriteValue(TEXT("EntryNodeGuid"), PathCost.EntryNodeGuid);
+        Writer.WriteValue(TEXT("GraphName"), PathCost.GraphName);
+        Writer.WriteValue(TEXT("EstimatedCost"), static_cast<double>(PathCost.EstimatedCost));
+        Writer.WriteValue(TEXT("MaxLoopNesting"), PathCost.MaxLoopNesting);
+        Writer.WriteArrayStart(TEXT("CostBreakdown"));
+        for (const FBPNodeCost& NodeCost : PathCost.CostBreakdown)
+        {
+            Writer.WriteObjectStart();
+            Writer.WriteValue(TEXT("NodeGuid"), NodeCost.NodeGuid);
+            Writer.WriteValue(TEXT("Summary"), NodeCost.Summary);
+            Writer.WriteValue(TEXT("GraphName"), NodeCost.GraphName);
+            Writer.WriteValue(TEXT("Cost"), static_cast<double>(NodeCost.Cost));
+            Writer.WriteValue(TEXT("LoopNesting"), NodeCost.LoopNesting);
+            Writer.WriteObjectEnd();
+        }
+        Writer.WriteArrayEnd();
+        Writer.WriteObjectEnd();
+    }
+    Writer.WriteArrayEnd();
+
+    Writer.WriteArrayStart(TEXT("Issues"));
+    for (const FBPPerformanceIssue& Issue : Report.Issues)
     {
-        if (Node->IsA<UK2Node_DynamicCast>())
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("IssueType"), Issue.IssueType);
+        Writer.WriteValue(TEXT("Description"), Issue.Description);
+        Writer.WriteValue(TEXT("Recommendation"), Issue.Recommendation);
+        Writer.WriteValue(TEXT("Severity"), FString(PerformanceSeverityToString(Issue.Severity)));
+        Writer.WriteValue(TEXT("NodeGuid"), Issue.NodeGuid);
+        Writer.WriteValue(TEXT("GraphName"), Issue.GraphName);
+        Writer.WriteValue(TEXT("Deduction"), Issue.Deduction);
+        if (Issue.EntryPath.Num() > 0)
         {
-            FBPPerformanceIssue Issue;
-            Issue.IssueType = TEXT("Cast in Tick");
-            Issue.Description = TEXT("Cast is performed every frame");
-            Issue.Recommendation = TEXT("Cache the cast result in BeginPlay and reuse the pointer (-10 points)");
-            Issue.Severity = EBPPerformanceSeverity::Warning;
-            Issue.NodeGuid = Node->NodeGuid.ToString();
-            Issue.Deduction = 10;
-            if (UEdGraph* G = Node->GetGraph()) Issue.GraphName = G->GetName();
-            Report.Issues.Add(Issue);
-            if (++TickCastCount >= 3) break;
+            WriteStringArrayJson(Writer, TEXT("EntryPath"), Issue.EntryPath);
         }
+        Writer.WriteObjectEnd();
     }
-
-    // Rule 3: Tick graph size (-15 if > 50 nodes downstream)
-    if (Report.TickNodeCount > 50)
-    {
-        FBPPerformanceIssue Issue;
-        Issue.IssueType = TEXT("Heavy Tick Logic");
-        Issue.Description = FString::Printf(TEXT("Tick event drives %d downstream nodes"), Report.TickNodeCount);
-        Issue.Recommendation = TEXT("Break Tick work across frames, move to timers, or switch to event-driven design (-15 points)");
-        Issue.Severity = EBPPerformanceSeverity::Warning;
-        Issue.Deduction = 15;
-        Report.Issues.Add(Issue);
-    }
-
-    // Rule 4: BeginPlay complexity (-10 if > 100 nodes downstream)
-    if (Report.BeginPlayNodeCount > 100)
-    {
-        FBPPerformanceIssue Issue;
-        Issue.IssueType = TEXT("Bloated BeginPlay");
-        Issue.Description = FString::Printf(TEXT("BeginPlay drives %d downstream nodes"), Report.BeginPlayNodeCount);
-        Issue.Recommendation = TEXT("Split initialization into smaller functions or defer heavy work (-10 points)");
-        Issue.Severity = EBPPerformanceSeverity::Warning;
-        Issue.Deduction = 10;
-        Report.Issues.Add(Issue);
-    }
-
-    // Rule 5: excessive total casts (-5 if > 20)
-    if (Report.CastCount > 20)
-    {
-        FBPPerformanceIssue Issue;
-        Issue.IssueType = TEXT("Excessive Casts");
-        Issue.Description = FString::Printf(TEXT("Blueprint contains %d Cast nodes"), Report.CastCount);
-        Issue.Recommendation = TEXT("Use interfaces or cached references instead of repeated Casts (-5 points)");
-        Issue.Severity = EBPPerformanceSeverity::Info;
-        Issue.Deduction = 5;
-        Report.Issues.Add(Issue);
-    }
-
-    // Final score
-    int32 Score = 100;
-    for (const FBPPerformanceIssue& Issue : Report.Issues)
-    {
-        Score -= Issue.Deduction;
-    }
-    Report.PerformanceScore = FMath::Clamp(Score, 0, 100);
-
-    return Report;
+    Writer.WriteArrayEnd();
+    WriteStageTimingsJson(Writer, Report.StageTimings);
+    Writer.WriteObjectEnd();
 }
 
 FString UBlueprintAnalyzerLibrary::ExportPerformanceReportToJSON(const FBPPerformanceReport& Report)
 {
-    TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject);
-    Root->SetStringField(TEXT("BlueprintName"), Report.BlueprintName);
-    Root->SetStringField(TEXT("AnalysisTimestamp"), Report.AnalysisTimestamp);
-    Root->SetNumberField(TEXT("TotalNodes"), Report.TotalNodes);
-    Root->SetNumberField(TEXT("EventCount"), Report.EventCount);
-    Root->SetNumberField(TEXT("CastCount"), Report.CastCount);
-    Root->SetNumberField(TEXT("TickNodeCount"), Report.TickNodeCount);
-    Root->SetNumberField(TEXT("BeginPlayNodeCount"), Report.BeginPlayNodeCount);
-    Root->SetNumberField(TEXT("PerformanceScore"), Report.PerformanceScore);
-
-    TArray<TSharedPtr<FJsonValue>> IssuesArr;
-    for (const FBPPerformanceIssue& Issue : Report.Issues)
-    {
-        TSharedPtr<FJsonObject> O = MakeShareable(new FJsonObject);
-        O->SetStringField(TEXT("IssueType"), Issue.IssueType);
-        O->SetStringField(TEXT("Description"), Issue.Description);
-        O->SetStringField(TEXT("Recommendation"), Issue.Recommendation);
-        O->SetStringField(TEXT("Severity"),
-            Issue.Severity == EBPPerformanceSeverity::Critical ? TEXT("Critical") :
-            Issue.Severity == EBPPerformanceSeverity::Warning ? TEXT("Warning") : TEXT("Info"));
-        O->SetStringField(TEXT("NodeGuid"), Issue.NodeGuid);
-        O->SetStringField(TEXT("GraphName"), Issue.GraphName);
-        O->SetNumberField(TEXT("Deduction"), Issue.Deduction);
-        IssuesArr.Add(MakeShareable(new FJsonValueObject(O)));
-    }
-    Root->SetArrayField(TEXT("Issues"), IssuesArr);
-
-    FString Out;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
-    FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
-    return Out;
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::ExportPerformanceReportToJSON);
+    return WriteJsonToString([&Report](auto& Writer) { WritePerformanceReportJson(Writer, Report); });
 }
 
 FString UBlueprintAnalyzerLibrary::ExportPerformanceReportToLLMText(const FBPPerformanceReport& Report)
 {
+    BPA_STAGE_SCOPE(ExportLLMText);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::ExportPerformanceReportToLLMText);
+
     FString Out;
     Out += FString::Printf(TEXT("Blueprint Performance Report: %s\n"), *Report.BlueprintName);
     Out += FString::Printf(TEXT("Analyzed at: %s\n\n"), *Report.AnalysisTimestamp);
@@ -966,8 +519,25 @@ FString UBlueprintAnalyzerLibrary::ExportPerformanceReportToLLMText(const FBPPer
     Out += FString::Printf(TEXT("Casts: %d\n"), Report.CastCount);
     Out += FString::Printf(TEXT("Tick downstream nodes: %d\n"), Report.TickNodeCount);
     Out += FString::Printf(TEXT("BeginPlay downstream nodes: %d\n"), Report.BeginPlayNodeCount);
+    Out += FString::Printf(TEXT("Estimated Tick cost: %.0f units/frame\n"), Report.EstimatedTickCost);
     Out += FString::Printf(TEXT("Performance Score: %d/100\n\n"), Report.PerformanceScore);
 
+    if (Report.TickPathCosts.Num() > 0)
+    {
+        Out += TEXT("=== TICK COST ===\n");
+        for (const FBPTickPathCost& PathCost : Report.TickPathCosts)
+        {
+            Out += FString::Printf(TEXT("%s (%s): %.0f units, loop nesting %d\n"),
+                *PathCost.EntryPointName, *PathCost.GraphName, PathCost.EstimatedCost, PathCost.MaxLoopNesting);
+            for (const FBPNodeCost& NodeCost : PathCost.CostBreakdown)
+            {
+                Out += FString::Printf(TEXT("  %.0f  %s"), NodeCost.Cost, *NodeCost.Summary);
+                Out += NodeCost.LoopNesting > 0 ? FString::Printf(TEXT(" [in %d loop(s)]\n"), NodeCost.LoopNesting) : FString(TEXT("\n"));
+            }
+        }
+        Out += TEXT("\n");
+    }
+
     Out += TEXT("=== ISSUES ===\n");
     if (Report.Issues.Num() == 0)
     {
@@ -985,6 +555,10 @@ FString UBlueprintAnalyzerLibrary::ExportPerformanceReportToLLMText(const FBPPer
             {
                 Out += FString::Printf(TEXT("  Graph: %s\n"), *Issue.GraphName);
             }
+            if (Issue.EntryPath.Num() > 0)
+            {
+                Out += FString::Printf(TEXT("  Path: %s\n"), *FString::Join(Issue.EntryPath, TEXT(" -> ")));
+            }
             Out += TEXT("\n");
         }
     }
@@ -992,50 +566,6 @@ FString UBlueprintAnalyzerLibrary::ExportPerformanceReportToLLMText(const FBPPer
     return Out;
 }
 
-TArray<FExecutionPath> UBlueprintAnalyzerLibrary::TraceExecutionPaths(UBlueprint* Blueprint)
-{
-    TArray<FExecutionPath> Paths;
-    if (!Blueprint) return Paths;
-
-    auto ProcessGraphsForEntryPoints = [&Paths](const TArray<UEdGraph*>& Graphs)
-    {
-        for (UEdGraph* Graph : Graphs)
-        {
-            if (!Graph) continue;
-
-            for (UEdGraphNode* GraphNode : Graph->Nodes)
-            {
-                UK2Node* K2Node = Cast<UK2Node>(GraphNode);
-                if (!K2Node) continue;
-
-                // Entry points: Event, CustomEvent, FunctionEntry
-                const bool bIsEntry = K2Node->IsA<UK2Node_Event>() ||
-                                      K2Node->IsA<UK2Node_CustomEvent>() ||
-                                      K2Node->IsA<UK2Node_FunctionEntry>();
-                if (!bIsEntry) continue;
-
-                FExecutionPath Path;
-                Path.EntryPointName = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-                Path.EntryNodeGuid = K2Node->NodeGuid.ToString();
-                Path.GraphName = Graph->GetName();
-
-                TSet<FGuid> Visited;
-                TraceFromNode(K2Node, 0, TEXT(""), Path.Steps, Visited);
-
-                if (Path.Steps.Num() > 0)
-                {
-                    Paths.Add(Path);
-                }
-            }
-        }
-    };
-
-    ProcessGraphsForEntryPoints(Blueprint->UbergraphPages);
-    ProcessGraphsForEntryPoints(Blueprint->FunctionGraphs);
-
-    return Paths;
-}
-
 // ============================================================
 // Phase 4: Project Dependency Analysis + Batch
 // ============================================================
@@ -1047,300 +577,347 @@ int32 UBlueprintAnalyzerLibrary::EstimateTokenCount(const FString& Text)
 
 TArray<FBPDependency> UBlueprintAnalyzerLibrary::ExtractBlueprintDependencies(UBlueprint* Blueprint)
 {
-    TArray<FBPDependency> Out;
-    if (!Blueprint) return Out;
-
-    const FString SelfName = Blueprint->GetName();
+    if (!Blueprint) return TArray<FBPDependency>();
 
-    auto ProcessGraph = [&](UEdGraph* Graph)
+    if (const FBPAnalysisCacheEntry* Cached = FBPAnalysisCache::Get().FindForBlueprint(Blueprint))
     {
-        if (!Graph) return;
-        const FString GraphName = Graph->GetName();
-        for (UEdGraphNode* GraphNode : Graph->Nodes)
-        {
-            UK2Node* K2Node = Cast<UK2Node>(GraphNode);
-            if (!K2Node) continue;
+        return Cached->Dependencies;
+    }
 
-            if (UK2Node_SpawnActorFromClass* SpawnNode = Cast<UK2Node_SpawnActorFromClass>(K2Node))
-            {
-                for (UEdGraphPin* Pin : SpawnNode->Pins)
-                {
-                    if (Pin->PinName == TEXT("Class") && Pin->DefaultObject)
-                    {
-                        FBPDependency Dep;
-                        Dep.ReferencingBlueprint = SelfName;
-                        Dep.ReferencedClass = Pin->DefaultObject->GetName();
-                        Dep.ReferenceType = TEXT("Spawn");
-                        Dep.NodeGuid = K2Node->NodeGuid.ToString();
-                        Dep.GraphName = GraphName;
-                        Out.Add(Dep);
-                    }
-                }
-            }
+    return FBPSnapshotAnalyzer::ExtractDependencies(FBPSnapshotAnalyzer::Capture(Blueprint));
+}
 
-            if (UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(K2Node))
-            {
-                if (CastNode->TargetType)
-                {
-                    FBPDependency Dep;
-                    Dep.ReferencingBlueprint = SelfName;
-                    Dep.ReferencedClass = CastNode->TargetType->GetName();
-                    Dep.ReferenceType = TEXT("Cast");
-                    Dep.NodeGuid = K2Node->NodeGuid.ToString();
-                    Dep.GraphName = GraphName;
-                    Out.Add(Dep);
-                }
-            }
+TArray<FBPDependencyCycle> UBlueprintAnalyzerLibrary::FindDependencyCycles(const TArray<FBPDependency>& Dependencies)
+{
+    TArray<FBPDependencyCycle> Cycles;
 
-            if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(K2Node))
-            {
-                if (UFunction* Fn = CallNode->GetTargetFunction())
-                {
-                    if (UClass* OwnerClass = Fn->GetOuterUClass())
-                    {
-                        const FString OwnerName = OwnerClass->GetName();
-                        if (OwnerName != SelfName &&
-                            OwnerName != TEXT("Object") &&
-                            OwnerName != TEXT("KismetSystemLibrary") &&
-                            OwnerName != TEXT("KismetMathLibrary") &&
-                            OwnerName != TEXT("KismetStringLibrary") &&
-                            OwnerName != TEXT("GameplayStatics"))
-                        {
-                            FBPDependency Dep;
-                            Dep.ReferencingBlueprint = SelfName;
-                            Dep.ReferencedClass = OwnerName;
-                            Dep.ReferenceType = TEXT("Call");
-                            Dep.NodeGuid = K2Node->NodeGuid.ToString();
-                            Dep.GraphName = GraphName;
-                            Out.Add(Dep);
-                        }
-                    }
-                }
-            }
+    // Intern names to dense IDs in first-seen order (asset order for folder runs)
+    TMap<FString, int32> VertexIds;
+    TArray<FString> VertexNames;
+    TArray<TPair<int32, int32>> Edges;
+    Edges.Reserve(Dependencies.Num());
 
-            for (UEdGraphPin* Pin : K2Node->Pins)
-            {
-                if (Pin->Direction == EGPD_Input && Pin->DefaultObject)
-                {
-                    if (UBlueprint* RefBP = Cast<UBlueprint>(Pin->DefaultObject))
-                    {
-                        FBPDependency Dep;
-                        Dep.ReferencingBlueprint = SelfName;
-                        Dep.ReferencedClass = RefBP->GetName();
-                        Dep.ReferenceType = TEXT("HardRef");
-                        Dep.NodeGuid = K2Node->NodeGuid.ToString();
-                        Dep.GraphName = GraphName;
-                        Out.Add(Dep);
-                    }
-                }
-            }
-        }
+    auto Intern = [&VertexIds, &VertexNames](const FString& Name)
+    {
+        if (const int32* Existing = VertexIds.Find(Name)) return *Existing;
+        VertexNames.Add(Name);
+        return VertexIds.Add(Name, VertexNames.Num() - 1);
     };
 
-    for (UEdGraph* G : Blueprint->UbergraphPages) ProcessGraph(G);
-    for (UEdGraph* G : Blueprint->FunctionGraphs) ProcessGraph(G);
+    for (const FBPDependency& Dep : Dependencies)
+    {
+        const int32 From = Intern(Dep.ReferencingBlueprint);
+        const int32 To = Intern(Dep.ReferencedClass);
+        Edges.Emplace(From, To);
+    }
 
-    return Out;
-}
+    // CSR adjacency (counting sort by source; duplicate edges are harmless to Tarjan/BFS)
+    const int32 NumVertices = VertexNames.Num();
+    TArray<int32> Offsets;
+    Offsets.SetNumZeroed(NumVertices + 1);
+    for (const TPair<int32, int32>& Edge : Edges)
+    {
+        Offsets[Edge.Key + 1]++;
+    }
+    for (int32 V = 0; V < NumVertices; ++V)
+    {
+        Offsets[V + 1] += Offsets[V];
+    }
+    TArray<int32> Targets;
+    Targets.SetNumUninitialized(Edges.Num());
+    {
+        TArray<int32> Cursor(Offsets.GetData(), NumVertices);
+        for (const TPair<int32, int32>& Edge : Edges)
+        {
+            Targets[Cursor[Edge.Key]++] = Edge.Value;
+        }
+    }
 
-static void FindDependencyCycles(
-    const TMap<FString, TArray<FString>>& AdjacencyList,
-    const FString& Start,
-    TArray<FString>& OutChains)
-{
-    TSet<FString> Visited;
-    TArray<FString> Path;
+    TArray<int32> ComponentOf;
+    const TArray<TArray<int32>> Components = FBPGraphAlgo::FindStronglyConnectedComponents(Offsets, Targets, &ComponentOf);
 
-    TFunction<void(const FString&)> DFS = [&](const FString& Node)
+    for (const TArray<int32>& Component : Components)
     {
-        Path.Add(Node);
-        Visited.Add(Node);
+        // Single vertices (including self-references) are not reported as cycles
+        if (Component.Num() < 2) continue;
 
-        if (const TArray<FString>* Neighbors = AdjacencyList.Find(Node))
+        FBPDependencyCycle& Cycle = Cycles.AddDefaulted_GetRef();
+        Cycle.Members.Reserve(Component.Num());
+        for (int32 Vertex : Component)
         {
-            for (const FString& Next : *Neighbors)
-            {
-                if (Next == Start && Path.Num() >= 2)
-                {
-                    FString Chain = Path[0];
-                    for (int32 i = 1; i < Path.Num(); ++i)
-                    {
-                        Chain += TEXT(" -> ") + Path[i];
-                    }
-                    Chain += TEXT(" -> ") + Start;
-                    OutChains.AddUnique(Chain);
-                }
-                else if (!Visited.Contains(Next))
-                {
-                    DFS(Next);
-                }
-            }
+            Cycle.Members.Add(VertexNames[Vertex]);
+        }
+        for (int32 Vertex : FBPGraphAlgo::FindCycleThrough(Offsets, Targets, ComponentOf, Component[0]))
+        {
+            Cycle.RepresentativeCycle.Add(VertexNames[Vertex]);
         }
+    }
 
-        Path.Pop();
-    };
+    return Cycles;
+}
+
+void UBlueprintAnalyzerLibrary::FindCircularDependencies(FBPProjectAnalysis& Analysis)
+{
+    BPA_STAGE_SCOPE(CycleDetection);
+
+    Analysis.DependencyCycles = FindDependencyCycles(Analysis.Dependencies);
+
+    Analysis.CircularDependencyChains.Reset(Analysis.DependencyCycles.Num());
+    for (const FBPDependencyCycle& Cycle : Analysis.DependencyCycles)
+    {
+        if (Cycle.RepresentativeCycle.Num() == 0) continue;
 
-    DFS(Start);
+        FString Chain = FString::Join(Cycle.RepresentativeCycle, TEXT(" -> "));
+        Chain += TEXT(" -> ") + Cycle.RepresentativeCycle[0];
+        Analysis.CircularDependencyChains.Add(MoveTemp(Chain));
+    }
 }
 
 FBPProjectAnalysis UBlueprintAnalyzerLibrary::AnalyzeFolder(const FString& FolderPath)
 {
-    FBPProjectAnalysis Result;
-    Result.FolderPath = FolderPath;
-    Result.AnalysisTimestamp = FDateTime::Now().ToString();
+    return AnalyzeFolderWithOptions(FolderPath, FBPFolderAnalysisOptions());
+}
 
+TArray<FAssetData> UBlueprintAnalyzerLibrary::FindBlueprintAssets(const TArray<FString>& FolderPaths, const TArray<FString>& PackageNames)
+{
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-    FARFilter Filter;
-    Filter.bRecursivePaths = true;
-    Filter.bRecursiveClasses = true;
-    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-    Filter.PackagePaths.Add(FName(*FolderPath));
-
     TArray<FAssetData> Assets;
-    AssetRegistry.GetAssets(Filter, Assets);
-
-    int32 ScoreSum = 0;
-    int32 NodeSum = 0;
 
-    for (const FAssetData& AssetData : Assets)
+    // Filter categories are AND-ed, so folders and explicit packages are separate queries
+    if (FolderPaths.Num() > 0)
     {
-        UBlueprint* BP = Cast<UBlueprint>(AssetData.GetAsset());
-        if (!BP) continue;
-
-        FBPBlueprintSummary Summary;
-        Summary.BlueprintName = BP->GetName();
-        Summary.BlueprintPath = AssetData.GetObjectPathString();
-        Summary.BlueprintType = GetBlueprintTypeString(BP);
-
-        int32 NodeCount = 0;
-        for (UEdGraph* G : BP->UbergraphPages)
+        FARFilter Filter;
+        Filter.bRecursivePaths = true;
+        Filter.bRecursiveClasses = true;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        for (const FString& FolderPath : FolderPaths)
         {
-            if (G) NodeCount += G->Nodes.Num();
+            Filter.PackagePaths.Add(FName(*FolderPath));
         }
-        for (UEdGraph* G : BP->FunctionGraphs)
+        AssetRegistry.GetAssets(Filter, Assets);
+    }
+    if (PackageNames.Num() > 0)
+    {
+        FARFilter Filter;
+        Filter.bRecursiveClasses = true;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        for (const FString& PackageName : PackageNames)
         {
-            if (G) NodeCount += G->Nodes.Num();
+            Filter.PackageNames.Add(FName(*PackageName));
         }
-        Summary.NodeCount = NodeCount;
-        NodeSum += NodeCount;
+        AssetRegistry.GetAssets(Filter, Assets);
+    }
+
+    // Registry enumeration order is not stable between runs; sort so the merged result is deterministic
+    Assets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.PackageName != B.PackageName
+            ? A.PackageName.LexicalLess(B.PackageName)
+            : A.AssetName.LexicalLess(B.AssetName);
+    });
 
-        FBPPerformanceReport PerfReport = AnalyzeBlueprintPerformance(BP);
-        Summary.PerformanceScore = PerfReport.PerformanceScore;
-        ScoreSum += PerfReport.PerformanceScore;
-        for (const FBPPerformanceIssue& Issue : PerfReport.Issues)
+    // A package can be both listed and inside a listed folder
+    for (int32 Index = Assets.Num() - 1; Index > 0; --Index)
+    {
+        if (Assets[Index].PackageName == Assets[Index - 1].PackageName && Assets[Index].AssetName == Assets[Index - 1].AssetName)
         {
-            if (Issue.Severity == EBPPerformanceSeverity::Critical)
-            {
-                Summary.CriticalIssues++;
-            }
+            Assets.RemoveAt(Index);
         }
-
-        FBlueprintAnalysisResult Analysis = AnalyzeBlueprint(BP);
-        const FString Text = ExportToLLMText(Analysis);
-        Summary.EstimatedTokenCount = EstimateTokenCount(Text);
-
-        Result.Dependencies.Append(ExtractBlueprintDependencies(BP));
-
-        Result.Summaries.Add(Summary);
-        Result.BlueprintsAnalyzed++;
     }
 
-    Result.TotalNodes = NodeSum;
-    Result.AveragePerformanceScore = Result.BlueprintsAnalyzed > 0
-        ? static_cast<float>(ScoreSum) / static_cast<float>(Result.BlueprintsAnalyzed)
-        : 100.0f;
+    return Assets;
+}
+
+FBPProjectAnalysis UBlueprintAnalyzerLibrary::AnalyzeFolderWithOptions(const FString& FolderPath, const FBPFolderAnalysisOptions& Options)
+{
+    const TArray<FAssetData> Assets = FindBlueprintAssets({ FolderPath }, {});
 
-    TMap<FString, TArray<FString>> Adjacency;
-    for (const FBPDependency& Dep : Result.Dependencies)
+    if (Options.bQuickScan)
     {
-        Adjacency.FindOrAdd(Dep.ReferencingBlueprint).AddUnique(Dep.ReferencedClass);
+        if (!Options.IndexFilePath.IsEmpty())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: quick scans load no graphs, so no project index is written"));
+        }
+        return FBPRegistryScan::ScanFolder(FolderPath, Assets);
     }
-    for (const auto& Pair : Adjacency)
+
+    FBPAnalysisPipeline Pipeline(FolderPath, Assets, Options);
+    while (Pipeline.Step())
     {
-        FindDependencyCycles(Adjacency, Pair.Key, Result.CircularDependencyChains);
     }
-
-    return Result;
+    return Pipeline.Finish();
 }
 
-FString UBlueprintAnalyzerLibrary::ExportProjectAnalysisToJSON(const FBPProjectAnalysis& Analysis)
+FBPProjectAnalysis UBlueprintAnalyzerLibrary::QuickScanFolder(const FString& FolderPath)
 {
-    TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject);
-    Root->SetStringField(TEXT("FolderPath"), Analysis.FolderPath);
-    Root->SetStringField(TEXT("AnalysisTimestamp"), Analysis.AnalysisTimestamp);
-    Root->SetNumberField(TEXT("BlueprintsAnalyzed"), Analysis.BlueprintsAnalyzed);
-    Root->SetNumberField(TEXT("TotalNodes"), Analysis.TotalNodes);
-    Root->SetNumberField(TEXT("AveragePerformanceScore"), Analysis.AveragePerformanceScore);
+    FBPFolderAnalysisOptions Options;
+    Options.bQuickScan = true;
+    return AnalyzeFolderWithOptions(FolderPath, Options);
+}
 
-    TArray<TSharedPtr<FJsonValue>> Summaries;
+template<typename JsonWriterType>
+static void WriteProjectAnalysisJson(JsonWriterType& Writer, const FBPProjectAnalysis& Analysis)
+{
+    Writer.WriteObjectStart();
+    Writer.WriteValue(TEXT("FolderPath"), Analysis.FolderPath);
+    Writer.WriteValue(TEXT("AnalysisTimestamp"), Analysis.AnalysisTimestamp);
+    Writer.WriteValue(TEXT("BlueprintsAnalyzed"), Analysis.BlueprintsAnalyzed);
+    Writer.WriteValue(TEXT("TotalNodes"), Analysis.TotalNodes);
+    Writer.WriteValue(TEXT("AveragePerformanceScore"), static_cast<double>(Analysis.AveragePerformanceScore));
+    Writer.WriteValue(TEXT("QuickScan"), Analysis.bQuickScan);
+    Writer.WriteValue(TEXT("PeakWorkingSetBytes"), Analysis.PeakWorkingSetBytes);
+    Writer.WriteValue(TEXT("ChunkCollections"), Analysis.ChunkCollections);
+    Writer.WriteValue(TEXT("PrefetchedPackages"), Analysis.PrefetchedPackages);
+    Writer.WriteValue(TEXT("LoadStalls"), Analysis.LoadStalls);
+    Writer.WriteValue(TEXT("LoadStallSeconds"), static_cast<double>(Analysis.LoadStallSeconds));
+
+    Writer.WriteArrayStart(TEXT("Summaries"));
     for (const FBPBlueprintSummary& S : Analysis.Summaries)
     {
-        TSharedPtr<FJsonObject> O = MakeShareable(new FJsonObject);
-        O->SetStringField(TEXT("BlueprintName"), S.BlueprintName);
-        O->SetStringField(TEXT("BlueprintPath"), S.BlueprintPath);
-        O->SetStringField(TEXT("BlueprintType"), S.BlueprintType);
-        O->SetNumberField(TEXT("NodeCount"), S.NodeCount);
-        O->SetNumberField(TEXT("PerformanceScore"), S.PerformanceScore);
-        O->SetNumberField(TEXT("CriticalIssues"), S.CriticalIssues);
-        O->SetNumberField(TEXT("EstimatedTokenCount"), S.EstimatedTokenCount);
-        Summaries.Add(MakeShareable(new FJsonValueObject(O)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("BlueprintName"), S.BlueprintName);
+        Writer.WriteValue(TEXT("BlueprintPath"), S.BlueprintPath);
+        Writer.WriteValue(TEXT("BlueprintType"), S.BlueprintType);
+        Writer.WriteValue(TEXT("NodeCount"), S.NodeCount);
+        Writer.WriteValue(TEXT("PerformanceScore"), S.PerformanceScore);
+        Writer.WriteValue(TEXT("CriticalIssues"), S.CriticalIssues);
+        Writer.WriteValue(TEXT("EstimatedTokenCount"), S.EstimatedTokenCount);
+        Writer.WriteValue(TEXT("EstimatedTickCost"), static_cast<double>(S.EstimatedTickCost));
+        Writer.WriteValue(TEXT("ParentClass"), S.ParentClass);
+        WriteStringArrayJson(Writer, TEXT("ImplementedInterfaces"), S.ImplementedInterfaces);
+        Writer.WriteValue(TEXT("PackageDiskSize"), S.PackageDiskSize);
+        Writer.WriteValue(TEXT("HardDependencyCount"), S.HardDependencyCount);
+        Writer.WriteValue(TEXT("SoftDependencyCount"), S.SoftDependencyCount);
+        Writer.WriteValue(TEXT("ReferencerCount"), S.ReferencerCount);
+        Writer.WriteObjectEnd();
+    }
+    Writer.WriteArrayEnd();
+
+    Writer.WriteArrayStart(TEXT("Dependencies"));
+    for (const FBPDependency& D : Analysis.Dependencies)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("ReferencingBlueprint"), D.ReferencingBlueprint);
+        Writer.WriteValue(TEXT("ReferencedClass"), D.ReferencedClass);
+        Writer.WriteValue(TEXT("ReferenceType"), D.ReferenceType);
+        Writer.WriteValue(TEXT("NodeGuid"), D.NodeGuid);
+        Writer.WriteValue(TEXT("GraphName"), D.GraphName);
+        Writer.WriteObjectEnd();
     }
-    Root->SetArrayField(TEXT("Summaries"), Summaries);
+    Writer.WriteArrayEnd();
+    WriteStringArrayJson(Writer, TEXT("CircularDependencyChains"), Analysis.CircularDependencyChains);
 
-    TArray<TSharedPtr<FJsonValue>> Deps;
-    for (const FBPDependency& D : Analysis.Dependencies)
+    Writer.WriteArrayStart(TEXT("DependencyCycles"));
+    for (const FBPDependencyCycle& Cycle : Analysis.DependencyCycles)
     {
-        TSharedPtr<FJsonObject> O = MakeShareable(new FJsonObject);
-        O->SetStringField(TEXT("ReferencingBlueprint"), D.ReferencingBlueprint);
-        O->SetStringField(TEXT("ReferencedClass"), D.ReferencedClass);
-        O->SetStringField(TEXT("ReferenceType"), D.ReferenceType);
-        O->SetStringField(TEXT("NodeGuid"), D.NodeGuid);
-        O->SetStringField(TEXT("GraphName"), D.GraphName);
-        Deps.Add(MakeShareable(new FJsonValueObject(O)));
+        Writer.WriteObjectStart();
+        WriteStringArrayJson(Writer, TEXT("Members"), Cycle.Members);
+        WriteStringArrayJson(Writer, TEXT("RepresentativeCycle"), Cycle.RepresentativeCycle);
+        Writer.WriteObjectEnd();
     }
-    Root->SetArrayField(TEXT("Dependencies"), Deps);
-    Root->SetArrayField(TEXT("CircularDependencyChains"), StringArrayToJson(Analysis.CircularDependencyChains));
+    Writer.WriteArrayEnd();
+    WriteStageTimingsJson(Writer, Analysis.StageTimings);
+    Writer.WriteObjectEnd();
+}
 
-    FString Out;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
-    FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
-    return Out;
+FString UBlueprintAnalyzerLibrary::ExportProjectAnalysisToJSON(const FBPProjectAnalysis& Analysis)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::ExportProjectAnalysisToJSON);
+    return WriteJsonToString([&Analysis](auto& Writer) { WriteProjectAnalysisJson(Writer, Analysis); });
 }
 
 FString UBlueprintAnalyzerLibrary::ExportProjectAnalysisToLLMText(const FBPProjectAnalysis& Analysis)
 {
+    BPA_STAGE_SCOPE(ExportLLMText);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::ExportProjectAnalysisToLLMText);
+
     FString Out;
     Out += FString::Printf(TEXT("Project Analysis: %s\n"), *Analysis.FolderPath);
     Out += FString::Printf(TEXT("Analyzed at: %s\n\n"), *Analysis.AnalysisTimestamp);
     Out += TEXT("=== SUMMARY ===\n");
     Out += FString::Printf(TEXT("Blueprints analyzed: %d\n"), Analysis.BlueprintsAnalyzed);
-    Out += FString::Printf(TEXT("Total nodes: %d\n"), Analysis.TotalNodes);
-    Out += FString::Printf(TEXT("Average performance score: %.1f/100\n\n"), Analysis.AveragePerformanceScore);
 
     TArray<FBPBlueprintSummary> SortedSummaries = Analysis.Summaries;
-    SortedSummaries.Sort([](const FBPBlueprintSummary& A, const FBPBlueprintSummary& B)
+    const int32 MaxShown = FMath::Min(SortedSummaries.Num(), 10);
+
+    if (Analysis.bQuickScan)
     {
-        return A.PerformanceScore < B.PerformanceScore;
-    });
+        // Registry-only data: rank by on-disk size, the best proxy available without loading
+        Out += TEXT("Mode: quick scan (asset registry only, graphs not loaded)\n\n");
 
-    Out += TEXT("=== TOP OFFENDERS (worst performance first) ===\n");
-    const int32 MaxShown = FMath::Min(SortedSummaries.Num(), 10);
-    for (int32 i = 0; i < MaxShown; ++i)
+        SortedSummaries.Sort([](const FBPBlueprintSummary& A, const FBPBlueprintSummary& B)
+        {
+            return A.PackageDiskSize > B.PackageDiskSize;
+        });
+
+        Out += TEXT("=== LARGEST BLUEPRINTS ===\n");
+        for (int32 i = 0; i < MaxShown; ++i)
+        {
+            const FBPBlueprintSummary& S = SortedSummaries[i];
+            Out += FString::Printf(TEXT("%d. %s (%s : %s) - %lld KB, %d hard deps, %d referencers\n"),
+                i + 1, *S.BlueprintName, *S.BlueprintType, *S.ParentClass, S.PackageDiskSize / 1024, S.HardDependencyCount, S.ReferencerCount);
+            if (S.ImplementedInterfaces.Num() > 0)
+            {
+                Out += FString::Printf(TEXT("   Interfaces: %s\n"), *FString::Join(S.ImplementedInterfaces, TEXT(", ")));
+            }
+        }
+        Out += TEXT("\n");
+    }
+    else
     {
-        const FBPBlueprintSummary& S = SortedSummaries[i];
-        Out += FString::Printf(TEXT("%d. %s (%s) - score %d/100, %d critical, %d nodes, ~%d tokens\n"),
-            i + 1, *S.BlueprintName, *S.BlueprintType, S.PerformanceScore, S.CriticalIssues, S.NodeCount, S.EstimatedTokenCount);
+        Out += FString::Printf(TEXT("Total nodes: %d\n"), Analysis.TotalNodes);
+        Out += FString::Printf(TEXT("Average performance score: %.1f/100\n\n"), Analysis.AveragePerformanceScore);
+
+        SortedSummaries.Sort([](const FBPBlueprintSummary& A, const FBPBlueprintSummary& B)
+        {
+            return A.PerformanceScore < B.PerformanceScore;
+        });
+
+        Out += TEXT("=== TOP OFFENDERS (worst performance first) ===\n");
+        for (int32 i = 0; i < MaxShown; ++i)
+        {
+            const FBPBlueprintSummary& S = SortedSummaries[i];
+            Out += FString::Printf(TEXT("%d. %s (%s) - score %d/100, %d critical, %d nodes, ~%d tokens\n"),
+                i + 1, *S.BlueprintName, *S.BlueprintType, S.PerformanceScore, S.CriticalIssues, S.NodeCount, S.EstimatedTokenCount);
+        }
+        Out += TEXT("\n");
+
+        // Expected frame-time impact; Blueprints without Tick logic are left out
+        SortedSummaries.Sort([](const FBPBlueprintSummary& A, const FBPBlueprintSummary& B)
+        {
+            return A.EstimatedTickCost > B.EstimatedTickCost;
+        });
+
+        if (SortedSummaries.Num() > 0 && SortedSummaries[0].EstimatedTickCost > 0.0f)
+        {
+            Out += TEXT("=== HIGHEST TICK COST (estimated units per frame) ===\n");
+            for (int32 i = 0; i < MaxShown && SortedSummaries[i].EstimatedTickCost > 0.0f; ++i)
+            {
+                const FBPBlueprintSummary& S = SortedSummaries[i];
+                Out += FString::Printf(TEXT("%d. %s (%s) - %.0f units\n"), i + 1, *S.BlueprintName, *S.BlueprintType, S.EstimatedTickCost);
+            }
+            Out += TEXT("\n");
+        }
     }
-    Out += TEXT("\n");
 
     if (Analysis.CircularDependencyChains.Num() > 0)
     {
         Out += TEXT("=== CIRCULAR DEPENDENCIES ===\n");
-        for (const FString& Chain : Analysis.CircularDependencyChains)
+        for (int32 i = 0; i < Analysis.CircularDependencyChains.Num(); ++i)
         {
-            Out += FString::Printf(TEXT("- %s\n"), *Chain);
+            Out += FString::Printf(TEXT("- %s\n"), *Analysis.CircularDependencyChains[i]);
+
+            // A component can be larger than its representative cycle; list everyone involved
+            if (Analysis.DependencyCycles.IsValidIndex(i))
+            {
+                const FBPDependencyCycle& Cycle = Analysis.DependencyCycles[i];
+                if (Cycle.Members.Num() > Cycle.RepresentativeCycle.Num())
+                {
+                    Out += FString::Printf(TEXT("  (%d members: %s)\n"), Cycle.Members.Num(), *FString::Join(Cycle.Members, TEXT(", ")));
+                }
+            }
         }
         Out += TEXT("\n");
     }
@@ -1355,355 +932,808 @@ FString UBlueprintAnalyzerLibrary::ExportProjectAnalysisToLLMText(const FBPProje
     return Out;
 }
 
-// Helper: converts TArray<FString> to JSON array of strings
-static TArray<TSharedPtr<FJsonValue>> StringArrayToJson(const TArray<FString>& InArray)
+// Helper: writes TArray<FString> as a JSON array of strings
+template<typename JsonWriterType>
+static void WriteStringArrayJson(JsonWriterType& Writer, const TCHAR* Identifier, const TArray<FString>& InArray)
 {
-    TArray<TSharedPtr<FJsonValue>> Out;
+    Writer.WriteArrayStart(Identifier);
     for (const FString& S : InArray)
     {
-        Out.Add(MakeShareable(new FJsonValueString(S)));
+        Writer.WriteValue(S);
     }
-    return Out;
+    Writer.WriteArrayEnd();
 }
 
-// Helper: converts FBPFunctionParam array to JSON
-static TArray<TSharedPtr<FJsonValue>> ParamsToJson(const TArray<FBPFunctionParam>& Params)
+// Helper: writes the "StageTimings" field; omitted when the report was not profiled
+template<typename JsonWriterType>
+static void WriteStageTimingsJson(JsonWriterType& Writer, const TArray<FBPStageTiming>& Timings)
 {
-    TArray<TSharedPtr<FJsonValue>> Out;
-    for (const FBPFunctionParam& P : Params)
+    if (Timings.Num() == 0) return;
+
+    Writer.WriteArrayStart(TEXT("StageTimings"));
+    for (const FBPStageTiming& Timing : Timings)
     {
-        TSharedPtr<FJsonObject> O = MakeShareable(new FJsonObject);
-        O->SetStringField(TEXT("ParamName"), P.ParamName);
-        O->SetStringField(TEXT("ParamType"), P.ParamType);
-        O->SetBoolField(TEXT("IsReference"), P.bIsReference);
-        O->SetBoolField(TEXT("IsConst"), P.bIsConst);
-        O->SetBoolField(TEXT("IsReturn"), P.bIsReturn);
-        Out.Add(MakeShareable(new FJsonValueObject(O)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("Stage"), Timing.Stage);
+        Writer.WriteValue(TEXT("Calls"), Timing.Calls);
+        Writer.WriteValue(TEXT("WallSeconds"), static_cast<double>(Timing.WallSeconds));
+        Writer.WriteValue(TEXT("PeakUsedPhysicalBytes"), Timing.PeakUsedPhysicalBytes);
+        Writer.WriteObjectEnd();
     }
-    return Out;
+    Writer.WriteArrayEnd();
 }
 
-static TSharedPtr<FJsonObject> MetadataToJson(const FBPAnalyzerMetadata& Meta)
+// Helper: writes an FBPFunctionParam array as the "Parameters" field
+template<typename JsonWriterType>
+static void WriteParamsJson(JsonWriterType& Writer, const TArray<FBPFunctionParam>& Params)
 {
-    TSharedPtr<FJsonObject> MetaObject = MakeShareable(new FJsonObject);
-    MetaObject->SetStringField(TEXT("BlueprintType"), Meta.BlueprintType);
-    MetaObject->SetStringField(TEXT("ParentClass"), Meta.ParentClass);
-    MetaObject->SetArrayField(TEXT("ImplementedInterfaces"), StringArrayToJson(Meta.ImplementedInterfaces));
-    MetaObject->SetArrayField(TEXT("MacroNames"), StringArrayToJson(Meta.MacroNames));
-    MetaObject->SetArrayField(TEXT("TimelineNames"), StringArrayToJson(Meta.TimelineNames));
+    Writer.WriteArrayStart(TEXT("Parameters"));
+    for (const FBPFunctionParam& P : Params)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("ParamName"), P.ParamName);
+        Writer.WriteValue(TEXT("ParamType"), P.ParamType);
+        Writer.WriteValue(TEXT("IsReference"), P.bIsReference);
+        Writer.WriteValue(TEXT("IsConst"), P.bIsConst);
+        Writer.WriteValue(TEXT("IsReturn"), P.bIsReturn);
+        Writer.WriteObjectEnd();
+    }
+    Writer.WriteArrayEnd();
+}
 
-    TArray<TSharedPtr<FJsonValue>> VarsJson;
+template<typename JsonWriterType>
+static void WriteMetadataJson(JsonWriterType& Writer, const FBPAnalyzerMetadata& Meta)
+{
+    Writer.WriteObjectStart(TEXT("Metadata"));
+    Writer.WriteValue(TEXT("BlueprintType"), Meta.BlueprintType);
+    Writer.WriteValue(TEXT("ParentClass"), Meta.ParentClass);
+    WriteStringArrayJson(Writer, TEXT("ImplementedInterfaces"), Meta.ImplementedInterfaces);
+    WriteStringArrayJson(Writer, TEXT("MacroNames"), Meta.MacroNames);
+    WriteStringArrayJson(Writer, TEXT("TimelineNames"), Meta.TimelineNames);
+
+    Writer.WriteArrayStart(TEXT("Variables"));
     for (const FBPVariableInfo& Var : Meta.Variables)
     {
-        TSharedPtr<FJsonObject> O = MakeShareable(new FJsonObject);
-        O->SetStringField(TEXT("VariableName"), Var.VariableName);
-        O->SetStringField(TEXT("VariableType"), Var.VariableType);
-        O->SetStringField(TEXT("DefaultValue"), Var.DefaultValue);
-        O->SetStringField(TEXT("Category"), Var.Category);
-        O->SetStringField(TEXT("Tooltip"), Var.Tooltip);
-        O->SetBoolField(TEXT("Editable"), Var.bEditable);
-        O->SetBoolField(TEXT("Replicated"), Var.bReplicated);
-        O->SetBoolField(TEXT("ExposeOnSpawn"), Var.bExposeOnSpawn);
-        VarsJson.Add(MakeShareable(new FJsonValueObject(O)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("VariableName"), Var.VariableName);
+        Writer.WriteValue(TEXT("VariableType"), Var.VariableType);
+        Writer.WriteValue(TEXT("DefaultValue"), Var.DefaultValue);
+        Writer.WriteValue(TEXT("Category"), Var.Category);
+        Writer.WriteValue(TEXT("Tooltip"), Var.Tooltip);
+        Writer.WriteValue(TEXT("Editable"), Var.bEditable);
+        Writer.WriteValue(TEXT("Replicated"), Var.bReplicated);
+        Writer.WriteValue(TEXT("ExposeOnSpawn"), Var.bExposeOnSpawn);
+        Writer.WriteObjectEnd();
     }
-    MetaObject->SetArrayField(TEXT("Variables"), VarsJson);
+    Writer.WriteArrayEnd();
 
-    TArray<TSharedPtr<FJsonValue>> FuncsJson;
+    Writer.WriteArrayStart(TEXT("CustomFunctions"));
     for (const FBPFunctionSignature& Fn : Meta.CustomFunctions)
     {
-        TSharedPtr<FJsonObject> O = MakeShareable(new FJsonObject);
-        O->SetStringField(TEXT("FunctionName"), Fn.FunctionName);
-        O->SetStringField(TEXT("ReturnType"), Fn.ReturnType);
-        O->SetStringField(TEXT("AccessSpecifier"), Fn.AccessSpecifier);
-        O->SetStringField(TEXT("Category"), Fn.Category);
-        O->SetBoolField(TEXT("Pure"), Fn.bPure);
-        O->SetBoolField(TEXT("Static"), Fn.bStatic);
-        O->SetBoolField(TEXT("Const"), Fn.bConst);
-        O->SetArrayField(TEXT("Parameters"), ParamsToJson(Fn.Parameters));
-        FuncsJson.Add(MakeShareable(new FJsonValueObject(O)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("FunctionName"), Fn.FunctionName);
+        Writer.WriteValue(TEXT("ReturnType"), Fn.ReturnType);
+        Writer.WriteValue(TEXT("AccessSpecifier"), Fn.AccessSpecifier);
+        Writer.WriteValue(TEXT("Category"), Fn.Category);
+        Writer.WriteValue(TEXT("Pure"), Fn.bPure);
+        Writer.WriteValue(TEXT("Static"), Fn.bStatic);
+        Writer.WriteValue(TEXT("Const"), Fn.bConst);
+        WriteParamsJson(Writer, Fn.Parameters);
+        Writer.WriteObjectEnd();
     }
-    MetaObject->SetArrayField(TEXT("CustomFunctions"), FuncsJson);
+    Writer.WriteArrayEnd();
 
-    TArray<TSharedPtr<FJsonValue>> CompsJson;
+    Writer.WriteArrayStart(TEXT("Components"));
     for (const FBPComponentInfo& Comp : Meta.Components)
     {
-        TSharedPtr<FJsonObject> O = MakeShareable(new FJsonObject);
-        O->SetStringField(TEXT("ComponentName"), Comp.ComponentName);
-        O->SetStringField(TEXT("ComponentType"), Comp.ComponentType);
-        O->SetStringField(TEXT("ParentComponentName"), Comp.ParentComponentName);
-        O->SetStringField(TEXT("AttachSocketName"), Comp.AttachSocketName);
-        CompsJson.Add(MakeShareable(new FJsonValueObject(O)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("ComponentName"), Comp.ComponentName);
+        Writer.WriteValue(TEXT("ComponentType"), Comp.ComponentType);
+        Writer.WriteValue(TEXT("ParentComponentName"), Comp.ParentComponentName);
+        Writer.WriteValue(TEXT("AttachSocketName"), Comp.AttachSocketName);
+        Writer.WriteObjectEnd();
     }
-    MetaObject->SetArrayField(TEXT("Components"), CompsJson);
+    Writer.WriteArrayEnd();
 
-    TArray<TSharedPtr<FJsonValue>> DispatchersJson;
+    Writer.WriteArrayStart(TEXT("EventDispatchers"));
     for (const FBPEventDispatcherInfo& Dispatcher : Meta.EventDispatchers)
     {
-        TSharedPtr<FJsonObject> O = MakeShareable(new FJsonObject);
-        O->SetStringField(TEXT("DispatcherName"), Dispatcher.DispatcherName);
-        O->SetArrayField(TEXT("Parameters"), ParamsToJson(Dispatcher.Parameters));
-        DispatchersJson.Add(MakeShareable(new FJsonValueObject(O)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("DispatcherName"), Dispatcher.DispatcherName);
+        WriteParamsJson(Writer, Dispatcher.Parameters);
+        Writer.WriteObjectEnd();
     }
-    MetaObject->SetArrayField(TEXT("EventDispatchers"), DispatchersJson);
-
-    return MetaObject;
+    Writer.WriteArrayEnd();
+    Writer.WriteObjectEnd();
 }
 
-FString UBlueprintAnalyzerLibrary::ExportToJSON(const FBlueprintAnalysisResult& AnalysisResult)
+template<typename JsonWriterType>
+static void WriteExecutionPathJson(JsonWriterType& Writer, const FExecutionPath& Path)
 {
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    Writer.WriteObjectStart();
+    Writer.WriteValue(TEXT("EntryPointName"), Path.EntryPointName);
+    Writer.WriteValue(TEXT("EntryNodeGuid"), Path.EntryNodeGuid);
+    Writer.WriteValue(TEXT("GraphName"), Path.GraphName);
+    if (Path.bTruncated)
+    {
+        Writer.WriteValue(TEXT("Truncated"), true);
+    }
+
+    Writer.WriteArrayStart(TEXT("Steps"));
+    for (const FExecutionStep& Step : Path.Steps)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("NodeGuid"), Step.NodeGuid);
+        Writer.WriteValue(TEXT("NodeType"), Step.NodeType);
+        Writer.WriteValue(TEXT("Summary"), Step.Summary);
+        Writer.WriteValue(TEXT("BranchLabel"), Step.BranchLabel);
+        Writer.WriteValue(TEXT("Depth"), Step.Depth);
+        Writer.WriteValue(TEXT("IsTerminator"), Step.bIsTerminator);
+        Writer.WriteValue(TEXT("IsLatent"), Step.bIsLatent);
+        if (Step.bIsTruncated)
+        {
+            Writer.WriteValue(TEXT("IsTruncated"), true);
+        }
+        if (Step.bIsSharedSegment)
+        {
+            Writer.WriteValue(TEXT("IsSharedSegment"), true);
+        }
+        if (Step.CallDepth > 0)
+        {
+            Writer.WriteValue(TEXT("CallDepth"), Step.CallDepth);
+        }
+        if (Step.bIsRecursiveCall)
+        {
+            Writer.WriteValue(TEXT("IsRecursiveCall"), true);
+        }
+        Writer.WriteObjectEnd();
+    }
+    Writer.WriteArrayEnd();
+    Writer.WriteObjectEnd();
+}
 
-    RootObject->SetStringField(TEXT("BlueprintName"), AnalysisResult.BlueprintName);
-    RootObject->SetStringField(TEXT("AnalysisTimestamp"), AnalysisResult.AnalysisTimestamp);
-    RootObject->SetObjectField(TEXT("Metadata"), MetadataToJson(AnalysisResult.Metadata));
+template<typename JsonWriterType>
+static void WriteAnalysisJson(JsonWriterType& Writer, const FBlueprintAnalysisResult& AnalysisResult)
+{
+    Writer.WriteObjectStart();
+    Writer.WriteValue(TEXT("BlueprintName"), AnalysisResult.BlueprintName);
+    Writer.WriteValue(TEXT("AnalysisTimestamp"), AnalysisResult.AnalysisTimestamp);
+    WriteMetadataJson(Writer, AnalysisResult.Metadata);
 
-    TArray<TSharedPtr<FJsonValue>> NodesArray;
+    Writer.WriteArrayStart(TEXT("Nodes"));
     for (const FBlueprintNodeInfo& Node : AnalysisResult.Nodes)
     {
-        TSharedPtr<FJsonObject> NodeObject = MakeShareable(new FJsonObject);
-        NodeObject->SetStringField(TEXT("NodeGuid"), Node.NodeGuid);
-        NodeObject->SetStringField(TEXT("NodeType"), Node.NodeType);
-        NodeObject->SetStringField(TEXT("NodeName"), Node.NodeName);
-        NodeObject->SetStringField(TEXT("FunctionName"), Node.FunctionName);
-        NodeObject->SetStringField(TEXT("GraphName"), Node.GraphName);
-        NodeObject->SetStringField(TEXT("CommentGroup"), Node.CommentGroup);
-        NodeObject->SetArrayField(TEXT("InputPins"), StringArrayToJson(Node.InputPins));
-        NodeObject->SetArrayField(TEXT("OutputPins"), StringArrayToJson(Node.OutputPins));
-        NodeObject->SetArrayField(TEXT("LiteralValues"), StringArrayToJson(Node.LiteralValues));
-        NodesArray.Add(MakeShareable(new FJsonValueObject(NodeObject)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("NodeGuid"), Node.NodeGuid);
+        Writer.WriteValue(TEXT("NodeType"), Node.NodeType);
+        Writer.WriteValue(TEXT("NodeName"), Node.NodeName);
+        Writer.WriteValue(TEXT("FunctionName"), Node.FunctionName);
+        Writer.WriteValue(TEXT("GraphName"), Node.GraphName);
+        Writer.WriteValue(TEXT("CommentGroup"), Node.CommentGroup);
+        WriteStringArrayJson(Writer, TEXT("InputPins"), Node.InputPins);
+        WriteStringArrayJson(Writer, TEXT("OutputPins"), Node.OutputPins);
+        WriteStringArrayJson(Writer, TEXT("LiteralValues"), Node.LiteralValues);
+        Writer.WriteObjectEnd();
     }
-    RootObject->SetArrayField(TEXT("Nodes"), NodesArray);
+    Writer.WriteArrayEnd();
 
     // Execution paths
-    TArray<TSharedPtr<FJsonValue>> PathsArray;
+    Writer.WriteArrayStart(TEXT("ExecutionPaths"));
     for (const FExecutionPath& Path : AnalysisResult.ExecutionPaths)
     {
-        TSharedPtr<FJsonObject> PathObject = MakeShareable(new FJsonObject);
-        PathObject->SetStringField(TEXT("EntryPointName"), Path.EntryPointName);
-        PathObject->SetStringField(TEXT("EntryNodeGuid"), Path.EntryNodeGuid);
-        PathObject->SetStringField(TEXT("GraphName"), Path.GraphName);
+        WriteExecutionPathJson(Writer, Path);
+    }
+    Writer.WriteArrayEnd();
 
-        TArray<TSharedPtr<FJsonValue>> StepsArray;
-        for (const FExecutionStep& Step : Path.Steps)
+    if (AnalysisResult.SharedSegments.Num() > 0)
+    {
+        Writer.WriteArrayStart(TEXT("SharedSegments"));
+        for (const FExecutionPath& Segment : AnalysisResult.SharedSegments)
         {
-            TSharedPtr<FJsonObject> StepObject = MakeShareable(new FJsonObject);
-            StepObject->SetStringField(TEXT("NodeGuid"), Step.NodeGuid);
-            StepObject->SetStringField(TEXT("NodeType"), Step.NodeType);
-            StepObject->SetStringField(TEXT("Summary"), Step.Summary);
-            StepObject->SetStringField(TEXT("BranchLabel"), Step.BranchLabel);
-            StepObject->SetNumberField(TEXT("Depth"), Step.Depth);
-            StepObject->SetBoolField(TEXT("IsTerminator"), Step.bIsTerminator);
-            StepObject->SetBoolField(TEXT("IsLatent"), Step.bIsLatent);
-            StepsArray.Add(MakeShareable(new FJsonValueObject(StepObject)));
+            WriteExecutionPathJson(Writer, Segment);
         }
-        PathObject->SetArrayField(TEXT("Steps"), StepsArray);
-        PathsArray.Add(MakeShareable(new FJsonValueObject(PathObject)));
+        Writer.WriteArrayEnd();
     }
-    RootObject->SetArrayField(TEXT("ExecutionPaths"), PathsArray);
 
-    TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
+    Writer.WriteArrayStart(TEXT("Connections"));
     for (const FBlueprintConnectionInfo& Connection : AnalysisResult.Connections)
     {
-        TSharedPtr<FJsonObject> ConnectionObject = MakeShareable(new FJsonObject);
-        ConnectionObject->SetStringField(TEXT("FromNodeGuid"), Connection.FromNodeGuid);
-        ConnectionObject->SetStringField(TEXT("FromPinName"), Connection.FromPinName);
-        ConnectionObject->SetStringField(TEXT("ToNodeGuid"), Connection.ToNodeGuid);
-        ConnectionObject->SetStringField(TEXT("ToPinName"), Connection.ToPinName);
-        
-        ConnectionsArray.Add(MakeShareable(new FJsonValueObject(ConnectionObject)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("FromNodeGuid"), Connection.FromNodeGuid);
+        Writer.WriteValue(TEXT("FromPinName"), Connection.FromPinName);
+        Writer.WriteValue(TEXT("ToNodeGuid"), Connection.ToNodeGuid);
+        Writer.WriteValue(TEXT("ToPinName"), Connection.ToPinName);
+        Writer.WriteObjectEnd();
     }
-    RootObject->SetArrayField(TEXT("Connections"), ConnectionsArray);
+    Writer.WriteArrayEnd();
+    Writer.WriteObjectEnd();
+}
+
+FString UBlueprintAnalyzerLibrary::ExportToJSON(const FBlueprintAnalysisResult& AnalysisResult)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::ExportToJSON);
+    return WriteJsonToString([&AnalysisResult](auto& Writer) { WriteAnalysisJson(Writer, AnalysisResult); });
+}
+
+// LLM text is produced through a sink so the same formatter can either build the string
+// or only measure it (folder runs need the size for token estimates, not the text).
+struct FBPLLMTextStringSink
+{
+    FString& Out;
+
+    void Write(const TCHAR* Text) { Out += Text; }
+    void Write(const FString& Text) { Out += Text; }
+    void Write(FName Name) { Name.AppendString(Out); }
+    void Write(const FGuid& Guid) { Out += Guid.ToString(); }
+    void WriteChars(TCHAR Char, int32 Count) { for (int32 i = 0; i < Count; ++i) Out.AppendChar(Char); }
+};
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
+struct FBPLLMTextCountingSink
+{
+    int64 NumChars = 0;
+
+    void Write(const TCHAR* Text) { NumChars += FCString::Strlen(Text); }
+    void Write(const FString& Text) { NumChars += Text.Len(); }
+    void Write(FName Name) { NumChars += Name.GetStringLength(); }
+    void Write(const FGuid& Guid) { NumChars += 32; } // EGuidFormats::Digits
+    void WriteChars(TCHAR Char, int32 Count) { NumChars += FMath::Max(Count, 0); }
+};
 
-    return OutputString;
+template<typename SinkType>
+static void WriteJoined(SinkType& Sink, const TArray<FString>& Items, const TCHAR* Separator)
+{
+    for (int32 i = 0; i < Items.Num(); ++i)
+    {
+        if (i > 0) Sink.Write(Separator);
+        Sink.Write(Items[i]);
+    }
 }
 
-FString UBlueprintAnalyzerLibrary::ExportToLLMText(const FBlueprintAnalysisResult& AnalysisResult)
+template<typename SinkType>
+static void WriteParams(SinkType& Sink, const TArray<FBPFunctionParam>& Params)
 {
-    FString Result;
+    for (int32 i = 0; i < Params.Num(); ++i)
+    {
+        if (i > 0) Sink.Write(TEXT(", "));
+        Sink.Write(Params[i].ParamType);
+        Sink.Write(TEXT(" "));
+        Sink.Write(Params[i].ParamName);
+    }
+}
 
-    Result += FString::Printf(TEXT("Blueprint Analysis: %s\n"), *AnalysisResult.BlueprintName);
-    Result += FString::Printf(TEXT("Analyzed at: %s\n\n"), *AnalysisResult.AnalysisTimestamp);
+template<typename SinkType>
+static void WriteLLMTextHeader(SinkType& Sink, const FString& BlueprintName, const FString& AnalysisTimestamp, const FBPAnalyzerMetadata& Meta)
+{
+    Sink.Write(TEXT("Blueprint Analysis: ")); Sink.Write(BlueprintName); Sink.Write(TEXT("\n"));
+    Sink.Write(TEXT("Analyzed at: ")); Sink.Write(AnalysisTimestamp); Sink.Write(TEXT("\n\n"));
 
     // Metadata section
-    const FBPAnalyzerMetadata& Meta = AnalysisResult.Metadata;
-    Result += TEXT("=== METADATA ===\n");
-    Result += FString::Printf(TEXT("BlueprintType: %s\n"), *Meta.BlueprintType);
-    Result += FString::Printf(TEXT("ParentClass: %s\n"), *Meta.ParentClass);
+    Sink.Write(TEXT("=== METADATA ===\n"));
+    Sink.Write(TEXT("BlueprintType: ")); Sink.Write(Meta.BlueprintType); Sink.Write(TEXT("\n"));
+    Sink.Write(TEXT("ParentClass: ")); Sink.Write(Meta.ParentClass); Sink.Write(TEXT("\n"));
     if (Meta.ImplementedInterfaces.Num() > 0)
     {
-        Result += FString::Printf(TEXT("Interfaces: %s\n"), *FString::Join(Meta.ImplementedInterfaces, TEXT(", ")));
+        Sink.Write(TEXT("Interfaces: "));
+        WriteJoined(Sink, Meta.ImplementedInterfaces, TEXT(", "));
+        Sink.Write(TEXT("\n"));
     }
-    Result += TEXT("\n");
+    Sink.Write(TEXT("\n"));
 
     if (Meta.Components.Num() > 0)
     {
-        Result += TEXT("--- Components ---\n");
+        Sink.Write(TEXT("--- Components ---\n"));
         for (const FBPComponentInfo& Comp : Meta.Components)
         {
-            Result += FString::Printf(TEXT("- %s (%s)"), *Comp.ComponentName, *Comp.ComponentType);
+            Sink.Write(TEXT("- ")); Sink.Write(Comp.ComponentName);
+            Sink.Write(TEXT(" (")); Sink.Write(Comp.ComponentType); Sink.Write(TEXT(")"));
             if (!Comp.ParentComponentName.IsEmpty())
             {
-                Result += FString::Printf(TEXT(" attached to %s"), *Comp.ParentComponentName);
+                Sink.Write(TEXT(" attached to ")); Sink.Write(Comp.ParentComponentName);
             }
-            Result += TEXT("\n");
+            Sink.Write(TEXT("\n"));
         }
-        Result += TEXT("\n");
+        Sink.Write(TEXT("\n"));
     }
 
     if (Meta.Variables.Num() > 0)
     {
-        Result += TEXT("--- Variables ---\n");
+        Sink.Write(TEXT("--- Variables ---\n"));
         for (const FBPVariableInfo& Var : Meta.Variables)
         {
-            FString Flags;
-            if (Var.bEditable) Flags += TEXT(" Editable");
-            if (Var.bReplicated) Flags += TEXT(" Replicated");
-            if (Var.bExposeOnSpawn) Flags += TEXT(" ExposeOnSpawn");
-            Result += FString::Printf(TEXT("- %s : %s"), *Var.VariableName, *Var.VariableType);
-            if (!Var.DefaultValue.IsEmpty()) Result += FString::Printf(TEXT(" = %s"), *Var.DefaultValue);
-            if (!Flags.IsEmpty()) Result += FString::Printf(TEXT(" [%s ]"), *Flags);
-            if (!Var.Category.IsEmpty() && Var.Category != TEXT("Default")) Result += FString::Printf(TEXT(" (Category: %s)"), *Var.Category);
-            Result += TEXT("\n");
+            Sink.Write(TEXT("- ")); Sink.Write(Var.VariableName);
+            Sink.Write(TEXT(" : ")); Sink.Write(Var.VariableType);
+            if (!Var.DefaultValue.IsEmpty())
+            {
+                Sink.Write(TEXT(" = ")); Sink.Write(Var.DefaultValue);
+            }
+            if (Var.bEditable || Var.bReplicated || Var.bExposeOnSpawn)
+            {
+                Sink.Write(TEXT(" ["));
+                if (Var.bEditable) Sink.Write(TEXT(" Editable"));
+                if (Var.bReplicated) Sink.Write(TEXT(" Replicated"));
+                if (Var.bExposeOnSpawn) Sink.Write(TEXT(" ExposeOnSpawn"));
+                Sink.Write(TEXT(" ]"));
+            }
+            if (!Var.Category.IsEmpty() && Var.Category != TEXT("Default"))
+            {
+                Sink.Write(TEXT(" (Category: ")); Sink.Write(Var.Category); Sink.Write(TEXT(")"));
+            }
+            Sink.Write(TEXT("\n"));
         }
-        Result += TEXT("\n");
+        Sink.Write(TEXT("\n"));
     }
 
     if (Meta.CustomFunctions.Num() > 0)
     {
-        Result += TEXT("--- Custom Functions ---\n");
+        Sink.Write(TEXT("--- Custom Functions ---\n"));
         for (const FBPFunctionSignature& Fn : Meta.CustomFunctions)
         {
-            FString ParamsStr;
-            for (int32 i = 0; i < Fn.Parameters.Num(); ++i)
+            Sink.Write(TEXT("- "));
+            if (Fn.ReturnType.IsEmpty()) Sink.Write(TEXT("void")); else Sink.Write(Fn.ReturnType);
+            Sink.Write(TEXT(" ")); Sink.Write(Fn.FunctionName);
+            Sink.Write(TEXT("(")); WriteParams(Sink, Fn.Parameters); Sink.Write(TEXT(")"));
+            if (Fn.bPure) Sink.Write(TEXT(" [Pure]"));
+            if (Fn.bStatic) Sink.Write(TEXT(" [Static]"));
+            if (Fn.bConst) Sink.Write(TEXT(" [Const]"));
+            if (!Fn.AccessSpecifier.IsEmpty() && Fn.AccessSpecifier != TEXT("Public"))
             {
-                if (i > 0) ParamsStr += TEXT(", ");
-                ParamsStr += FString::Printf(TEXT("%s %s"), *Fn.Parameters[i].ParamType, *Fn.Parameters[i].ParamName);
+                Sink.Write(TEXT(" [")); Sink.Write(Fn.AccessSpecifier); Sink.Write(TEXT("]"));
             }
-            const FString ReturnType = Fn.ReturnType.IsEmpty() ? TEXT("void") : Fn.ReturnType;
-            Result += FString::Printf(TEXT("- %s %s(%s)"), *ReturnType, *Fn.FunctionName, *ParamsStr);
-            if (Fn.bPure) Result += TEXT(" [Pure]");
-            if (Fn.bStatic) Result += TEXT(" [Static]");
-            if (Fn.bConst) Result += TEXT(" [Const]");
-            if (!Fn.AccessSpecifier.IsEmpty() && Fn.AccessSpecifier != TEXT("Public")) Result += FString::Printf(TEXT(" [%s]"), *Fn.AccessSpecifier);
-            Result += TEXT("\n");
+            Sink.Write(TEXT("\n"));
         }
-        Result += TEXT("\n");
+        Sink.Write(TEXT("\n"));
     }
 
     if (Meta.EventDispatchers.Num() > 0)
     {
-        Result += TEXT("--- Event Dispatchers ---\n");
+        Sink.Write(TEXT("--- Event Dispatchers ---\n"));
         for (const FBPEventDispatcherInfo& Dispatcher : Meta.EventDispatchers)
         {
-            FString ParamsStr;
-            for (int32 i = 0; i < Dispatcher.Parameters.Num(); ++i)
-            {
-                if (i > 0) ParamsStr += TEXT(", ");
-                ParamsStr += FString::Printf(TEXT("%s %s"), *Dispatcher.Parameters[i].ParamType, *Dispatcher.Parameters[i].ParamName);
-            }
-            Result += FString::Printf(TEXT("- %s(%s)\n"), *Dispatcher.DispatcherName, *ParamsStr);
+            Sink.Write(TEXT("- ")); Sink.Write(Dispatcher.DispatcherName);
+            Sink.Write(TEXT("(")); WriteParams(Sink, Dispatcher.Parameters); Sink.Write(TEXT(")\n"));
         }
-        Result += TEXT("\n");
+        Sink.Write(TEXT("\n"));
     }
 
     if (Meta.MacroNames.Num() > 0)
     {
-        Result += FString::Printf(TEXT("Macros: %s\n\n"), *FString::Join(Meta.MacroNames, TEXT(", ")));
+        Sink.Write(TEXT("Macros: "));
+        WriteJoined(Sink, Meta.MacroNames, TEXT(", "));
+        Sink.Write(TEXT("\n\n"));
     }
     if (Meta.TimelineNames.Num() > 0)
     {
-        Result += FString::Printf(TEXT("Timelines: %s\n\n"), *FString::Join(Meta.TimelineNames, TEXT(", ")));
+        Sink.Write(TEXT("Timelines: "));
+        WriteJoined(Sink, Meta.TimelineNames, TEXT(", "));
+        Sink.Write(TEXT("\n\n"));
     }
+}
 
-    Result += TEXT("=== NODES ===\n");
-    for (const FBlueprintNodeInfo& Node : AnalysisResult.Nodes)
+// How a step line ends after its summary; the view decides which applies
+enum class EBPLLMStepMarker : uint8
+{
+    None,
+    Truncated,
+    Shared,
+    Cycle,
+};
+
+enum class EBPLLMPinList : uint8
+{
+    Inputs,
+    Outputs,
+    Literals,
+};
+
+static bool IsEmptyLabel(const FString& Label) { return Label.IsEmpty(); }
+static bool IsEmptyLabel(FName Label) { return Label.IsNone(); }
+
+// The one LLM text formatter. ViewType reads either an FBlueprintAnalysisResult or a captured
+// snapshot and its trace, so both produce the same text from a single set of emitters.
+template<typename ViewType, typename SinkType>
+static void WriteLLMText(const ViewType& View, SinkType& Sink)
+{
+    WriteLLMTextHeader(Sink, View.GetBlueprintName(), View.GetAnalysisTimestamp(), View.GetMetadata());
+
+    Sink.Write(TEXT("=== NODES ===\n"));
+    for (int32 NodeIndex = 0; NodeIndex < View.NumNodes(); ++NodeIndex)
     {
-        Result += FString::Printf(TEXT("- %s [%s]: %s"), *Node.NodeType, *Node.NodeGuid, *Node.NodeName);
-        if (!Node.GraphName.IsEmpty())
+        const FString& GraphName = View.GetGraphName(NodeIndex);
+        const FString& FunctionName = View.GetFunctionName(NodeIndex);
+        const FString& CommentGroup = View.GetCommentGroup(NodeIndex);
+
+        Sink.Write(TEXT("- ")); Sink.Write(View.GetNodeType(NodeIndex));
+        Sink.Write(TEXT(" [")); Sink.Write(View.GetNodeGuid(NodeIndex));
+        Sink.Write(TEXT("]: ")); Sink.Write(View.GetNodeName(NodeIndex));
+        if (!GraphName.IsEmpty())
         {
-            Result += FString::Printf(TEXT("  (in graph: %s)"), *Node.GraphName);
+            Sink.Write(TEXT("  (in graph: ")); Sink.Write(GraphName); Sink.Write(TEXT(")"));
         }
-        Result += TEXT("\n");
-        if (!Node.FunctionName.IsEmpty())
+        Sink.Write(TEXT("\n"));
+        if (!FunctionName.IsEmpty())
         {
-            Result += FString::Printf(TEXT("  Function: %s\n"), *Node.FunctionName);
+            Sink.Write(TEXT("  Function: ")); Sink.Write(FunctionName); Sink.Write(TEXT("\n"));
         }
-        if (Node.InputPins.Num() > 0)
+        if (View.HasPins(NodeIndex, EBPLLMPinList::Inputs))
         {
-            Result += FString::Printf(TEXT("  Inputs: %s\n"), *FString::Join(Node.InputPins, TEXT(", ")));
+            Sink.Write(TEXT("  Inputs: ")); View.WritePins(Sink, NodeIndex, EBPLLMPinList::Inputs); Sink.Write(TEXT("\n"));
         }
-        if (Node.OutputPins.Num() > 0)
+        if (View.HasPins(NodeIndex, EBPLLMPinList::Outputs))
         {
-            Result += FString::Printf(TEXT("  Outputs: %s\n"), *FString::Join(Node.OutputPins, TEXT(", ")));
+            Sink.Write(TEXT("  Outputs: ")); View.WritePins(Sink, NodeIndex, EBPLLMPinList::Outputs); Sink.Write(TEXT("\n"));
         }
-        if (Node.LiteralValues.Num() > 0)
+        if (View.HasPins(NodeIndex, EBPLLMPinList::Literals))
         {
-            Result += FString::Printf(TEXT("  Literals: %s\n"), *FString::Join(Node.LiteralValues, TEXT(", ")));
+            Sink.Write(TEXT("  Literals: ")); View.WritePins(Sink, NodeIndex, EBPLLMPinList::Literals); Sink.Write(TEXT("\n"));
         }
-        if (!Node.CommentGroup.IsEmpty())
+        if (!CommentGroup.IsEmpty())
         {
-            Result += FString::Printf(TEXT("  Comment: %s\n"), *Node.CommentGroup);
+            Sink.Write(TEXT("  Comment: ")); Sink.Write(CommentGroup); Sink.Write(TEXT("\n"));
         }
-        Result += TEXT("\n");
+        Sink.Write(TEXT("\n"));
     }
 
-    Result += TEXT("=== CONNECTIONS ===\n");
-    for (const FBlueprintConnectionInfo& Connection : AnalysisResult.Connections)
+    Sink.Write(TEXT("=== CONNECTIONS ===\n"));
+    View.ForEachConnection([&Sink](const auto& FromNodeGuid, const auto& FromPinName, const auto& ToNodeGuid, const auto& ToPinName)
+    {
+        Sink.Write(FromNodeGuid); Sink.Write(TEXT(".")); Sink.Write(FromPinName);
+        Sink.Write(TEXT(" -> "));
+        Sink.Write(ToNodeGuid); Sink.Write(TEXT(".")); Sink.Write(ToPinName);
+        Sink.Write(TEXT("\n"));
+    });
+
+    // Execution paths — tree-like indented view for LLM consumption. Shared segments are
+    // numbered by position; SegmentNumber is INDEX_NONE when the referenced segment is unknown.
+    auto WriteStep = [&Sink](int32 Depth, const auto& BranchLabel, const TCHAR* SummaryPrefix, const FString& Summary,
+        bool bIsLatent, bool bIsRecursiveCall, EBPLLMStepMarker Marker, int32 SegmentNumber)
+    {
+        Sink.WriteChars(TEXT(' '), Depth * 2);
+        Sink.Write(TEXT("- "));
+        if (!IsEmptyLabel(BranchLabel))
+        {
+            Sink.Write(TEXT("[")); Sink.Write(BranchLabel); Sink.Write(TEXT("] "));
+        }
+        Sink.Write(SummaryPrefix); Sink.Write(Summary);
+        if (bIsLatent) Sink.Write(TEXT(" (latent)"));
+        if (bIsRecursiveCall) Sink.Write(TEXT(" (recursive)"));
+        switch (Marker)
+        {
+        case EBPLLMStepMarker::Truncated:
+            Sink.Write(TEXT(" (truncated)"));
+            break;
+        case EBPLLMStepMarker::Shared:
+            Sink.Write(TEXT(" (shared #")); Sink.Write(SegmentNumber != INDEX_NONE ? FString::FromInt(SegmentNumber) : FString(TEXT("?"))); Sink.Write(TEXT(")"));
+            break;
+        case EBPLLMStepMarker::Cycle:
+            Sink.Write(TEXT(" (cycle)"));
+            break;
+        default:
+            break;
+        }
+        Sink.Write(TEXT("\n"));
+    };
+
+    if (View.NumPaths() > 0)
+    {
+        Sink.Write(TEXT("\n=== EXECUTION FLOW ===\n"));
+        for (int32 PathIndex = 0; PathIndex < View.NumPaths(); ++PathIndex)
+        {
+            Sink.Write(TEXT("\n[")); Sink.Write(View.GetPathEntryName(PathIndex));
+            Sink.Write(TEXT("] in ")); Sink.Write(View.GetPathGraphName(PathIndex, false)); Sink.Write(TEXT("\n"));
+            View.ForEachStep(PathIndex, false, WriteStep);
+        }
+    }
+
+    if (View.NumSegments() > 0)
+    {
+        Sink.Write(TEXT("\n=== SHARED FLOW ===\n"));
+        for (int32 SegmentIndex = 0; SegmentIndex < View.NumSegments(); ++SegmentIndex)
+        {
+            Sink.Write(TEXT("\n[shared #")); Sink.Write(FString::FromInt(SegmentIndex));
+            Sink.Write(TEXT("] in ")); Sink.Write(View.GetPathGraphName(SegmentIndex, true)); Sink.Write(TEXT("\n"));
+            View.ForEachStep(SegmentIndex, true, WriteStep);
+        }
+    }
+}
+
+// LLM text view of an analysis result, whose step summaries already carry their prefix
+struct FBPResultLLMView
+{
+    explicit FBPResultLLMView(const FBlueprintAnalysisResult& InResult)
+        : Result(InResult)
+    {
+        SegmentNumbers.Reserve(Result.SharedSegments.Num());
+        for (int32 SegmentIndex = 0; SegmentIndex < Result.SharedSegments.Num(); ++SegmentIndex)
+        {
+            SegmentNumbers.Add(Result.SharedSegments[SegmentIndex].EntryNodeGuid, SegmentIndex);
+        }
+    }
+
+    const FString& GetBlueprintName() const { return Result.BlueprintName; }
+    const FString& GetAnalysisTimestamp() const { return Result.AnalysisTimestamp; }
+    const FBPAnalyzerMetadata& GetMetadata() const { return Result.Metadata; }
+
+    int32 NumNodes() const { return Result.Nodes.Num(); }
+    const FString& GetNodeType(int32 NodeIndex) const { return Result.Nodes[NodeIndex].NodeType; }
+    const FString& GetNodeGuid(int32 NodeIndex) const { return Result.Nodes[NodeIndex].NodeGuid; }
+    const FString& GetNodeName(int32 NodeIndex) const { return Result.Nodes[NodeIndex].NodeName; }
+    const FString& GetGraphName(int32 NodeIndex) const { return Result.Nodes[NodeIndex].GraphName; }
+    const FString& GetFunctionName(int32 NodeIndex) const { return Result.Nodes[NodeIndex].FunctionName; }
+    const FString& GetCommentGroup(int32 NodeIndex) const { return Result.Nodes[NodeIndex].CommentGroup; }
+
+    bool HasPins(int32 NodeIndex, EBPLLMPinList List) const { return GetPinList(NodeIndex, List).Num() > 0; }
+
+    template<typename SinkType>
+    void WritePins(SinkType& Sink, int32 NodeIndex, EBPLLMPinList List) const
+    {
+        WriteJoined(Sink, GetPinList(NodeIndex, List), TEXT(", "));
+    }
+
+    template<typename FuncType>
+    void ForEachConnection(FuncType&& Func) const
+    {
+        for (const FBlueprintConnectionInfo& Connection : Result.Connections)
+        {
+            Func(Connection.FromNodeGuid, Connection.FromPinName, Connection.ToNodeGuid, Connection.ToPinName);
+        }
+    }
+
+    int32 NumPaths() const { return Result.ExecutionPaths.Num(); }
+    int32 NumSegments() const { return Result.SharedSegments.Num(); }
+    const FString& GetPathEntryName(int32 PathIndex) const { return Result.ExecutionPaths[PathIndex].EntryPointName; }
+    const FString& GetPathGraphName(int32 PathIndex, bool bSegment) const { return GetPath(PathIndex, bSegment).GraphName; }
+
+    template<typename FuncType>
+    void ForEachStep(int32 PathIndex, bool bSegment, FuncType&& Func) const
+    {
+        for (const FExecutionStep& Step : GetPath(PathIndex, bSegment).Steps)
+        {
+            EBPLLMStepMarker Marker = EBPLLMStepMarker::None;
+            int32 SegmentNumber = INDEX_NONE;
+            if (Step.bIsTruncated)
+            {
+                Marker = EBPLLMStepMarker::Truncated;
+            }
+            else if (Step.bIsSharedSegment)
+            {
+                Marker = EBPLLMStepMarker::Shared;
+                const int32* Found = SegmentNumbers.Find(Step.NodeGuid);
+                SegmentNumber = Found ? *Found : INDEX_NONE;
+            }
+            else if (Step.bIsTerminator)
+            {
+                Marker = EBPLLMStepMarker::Cycle;
+            }
+            Func(Step.Depth, Step.BranchLabel, TEXT(""), Step.Summary, Step.bIsLatent, Step.bIsRecursiveCall, Marker, SegmentNumber);
+        }
+    }
+
+private:
+    const TArray<FString>& GetPinList(int32 NodeIndex, EBPLLMPinList List) const
+    {
+        const FBlueprintNodeInfo& Node = Result.Nodes[NodeIndex];
+        return List == EBPLLMPinList::Inputs ? Node.InputPins : List == EBPLLMPinList::Outputs ? Node.OutputPins : Node.LiteralValues;
+    }
+
+    const FExecutionPath& GetPath(int32 PathIndex, bool bSegment) const
+    {
+        return bSegment ? Result.SharedSegments[PathIndex] : Result.ExecutionPaths[PathIndex];
+    }
+
+    const FBlueprintAnalysisResult& Result;
+
+    // The data refers to shared segments by first node GUID
+    TMap<FString, int32> SegmentNumbers;
+};
+
+// LLM text view read straight from the compact snapshot and trace, so no per-node,
+// per-connection or per-step strings are built. Same text as FBPResultLLMView over
+// FBPSnapshotAnalyzer::BuildAnalysisResult(Snapshot).
+struct FBPSnapshotLLMView
+{
+    const FBPBlueprintSnapshot& Snapshot;
+    const FBPTraceSet& Trace;
+    const FString& AnalysisTimestamp;
+
+    const FString& GetBlueprintName() const { return Snapshot.BlueprintName; }
+    const FString& GetAnalysisTimestamp() const { return AnalysisTimestamp; }
+    const FBPAnalyzerMetadata& GetMetadata() const { return Snapshot.Metadata; }
+
+    int32 NumNodes() const { return Snapshot.Nodes.Num(); }
+    const FString& GetNodeType(int32 NodeIndex) const { return Snapshot.Nodes[NodeIndex].NodeType; }
+    const FGuid& GetNodeGuid(int32 NodeIndex) const { return Snapshot.Nodes[NodeIndex].NodeGuid; }
+    const FString& GetNodeName(int32 NodeIndex) const { return Snapshot.Nodes[NodeIndex].Title; }
+    const FString& GetGraphName(int32 NodeIndex) const { return Snapshot.GetGraph(Snapshot.Nodes[NodeIndex]).GraphName; }
+    const FString& GetFunctionName(int32 NodeIndex) const { return Snapshot.Nodes[NodeIndex].FunctionName; }
+    const FString& GetCommentGroup(int32 NodeIndex) const { return Snapshot.Nodes[NodeIndex].CommentGroup; }
+
+    bool HasPins(int32 NodeIndex, EBPLLMPinList List) const
+    {
+        for (const FBPPinSnapshot& Pin : Snapshot.GetPins(Snapshot.Nodes[NodeIndex]))
+        {
+            if (IsListed(Pin, List)) return true;
+        }
+        return false;
+    }
+
+    template<typename SinkType>
+    void WritePins(SinkType& Sink, int32 NodeIndex, EBPLLMPinList List) const
     {
-        Result += FString::Printf(TEXT("%s.%s -> %s.%s\n"),
-            *Connection.FromNodeGuid, *Connection.FromPinName,
-            *Connection.ToNodeGuid, *Connection.ToPinName);
+        const bool bLiterals = List == EBPLLMPinList::Literals;
+        bool bFirst = true;
+        for (const FBPPinSnapshot& Pin : Snapshot.GetPins(Snapshot.Nodes[NodeIndex]))
+        {
+            if (!IsListed(Pin, List)) continue;
+
+            if (!bFirst) Sink.Write(TEXT(", "));
+            bFirst = false;
+
+            Sink.Write(Pin.PinName);
+            Sink.Write(bLiterals ? TEXT("=") : TEXT(":"));
+            Sink.Write(bLiterals ? Pin.Literal : Pin.TypeString);
+        }
     }
 
-    // Execution paths — tree-like indented view for LLM consumption
-    if (AnalysisResult.ExecutionPaths.Num() > 0)
+    template<typename FuncType>
+    void ForEachConnection(FuncType&& Func) const
     {
-        Result += TEXT("\n=== EXECUTION FLOW ===\n");
-        for (const FExecutionPath& Path : AnalysisResult.ExecutionPaths)
+        for (const FBPNodeSnapshot& Node : Snapshot.Nodes)
         {
-            Result += FString::Printf(TEXT("\n[%s] in %s\n"), *Path.EntryPointName, *Path.GraphName);
-            for (const FExecutionStep& Step : Path.Steps)
+            for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
             {
-                const FString Indent = FString::ChrN(Step.Depth * 2, ' ');
-                FString Prefix;
-                if (!Step.BranchLabel.IsEmpty())
+                const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+                if (Pin.Direction != EGPD_Output) continue;
+
+                for (const FBPPinLink& Link : Snapshot.GetLinks(PinIndex))
                 {
-                    Prefix = FString::Printf(TEXT("[%s] "), *Step.BranchLabel);
+                    Func(Node.NodeGuid, Pin.PinName, Snapshot.GetLinkedNodeGuid(Link), Snapshot.GetLinkedPinName(Link));
                 }
-                FString Suffix;
-                if (Step.bIsLatent) Suffix += TEXT(" (latent)");
-                if (Step.bIsTerminator) Suffix += TEXT(" (cycle)");
-                Result += FString::Printf(TEXT("%s- %s%s%s\n"), *Indent, *Prefix, *Step.Summary, *Suffix);
             }
         }
     }
 
+    int32 NumPaths() const { return Trace.Paths.Num(); }
+    int32 NumSegments() const { return Trace.Segments.Num(); }
+    const FString& GetPathEntryName(int32 PathIndex) const { return Snapshot.Nodes[Trace.Paths[PathIndex].EntryNode].Title; }
+    const FString& GetPathGraphName(int32 PathIndex, bool bSegment) const { return GetGraphName(GetPath(PathIndex, bSegment).EntryNode); }
+
+    template<typename FuncType>
+    void ForEachStep(int32 PathIndex, bool bSegment, FuncType&& Func) const
+    {
+        for (const FBPTraceStep& Step : Trace.GetSteps(GetPath(PathIndex, bSegment)))
+        {
+            const FBPNodeSnapshot& Node = Snapshot.Nodes[Step.NodeIndex];
+            const bool bTraced = !Step.bIsTruncated && !Step.bIsTerminator && Step.SegmentIndex == INDEX_NONE;
+
+            EBPLLMStepMarker Marker = EBPLLMStepMarker::None;
+            if (Step.bIsTruncated) Marker = EBPLLMStepMarker::Truncated;
+            else if (Step.SegmentIndex != INDEX_NONE) Marker = EBPLLMStepMarker::Shared;
+            else if (Step.bIsTerminator) Marker = EBPLLMStepMarker::Cycle;
+
+            Func(Step.Depth, Step.BranchLabel, FBPSnapshotAnalyzer::GetStepSummaryPrefix(Step), Node.StepSummary,
+                bTraced && Node.bIsLatent, bTraced && Step.bIsRecursiveCall, Marker, Step.SegmentIndex);
+        }
+    }
+
+private:
+    static bool IsListed(const FBPPinSnapshot& Pin, EBPLLMPinList List)
+    {
+        switch (List)
+        {
+        case EBPLLMPinList::Inputs: return Pin.Direction == EGPD_Input;
+        case EBPLLMPinList::Outputs: return Pin.Direction == EGPD_Output;
+        default: return Pin.Direction == EGPD_Input && !Pin.Literal.IsEmpty();
+        }
+    }
+
+    const FBPTracePath& GetPath(int32 PathIndex, bool bSegment) const
+    {
+        return bSegment ? Trace.Segments[PathIndex] : Trace.Paths[PathIndex];
+    }
+};
+
+FString UBlueprintAnalyzerLibrary::ExportToLLMText(const FBlueprintAnalysisResult& AnalysisResult)
+{
+    BPA_STAGE_SCOPE(ExportLLMText);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::ExportToLLMText);
+
+    // One formatting pass into a growing string; measuring first would format everything twice.
+    // The reserve is only a starting size, so early growth does not reallocate per node.
+    FString Result;
+    Result.Reserve(AnalysisResult.Nodes.Num() * 128 + AnalysisResult.Connections.Num() * 80 + 1024);
+
+    FBPLLMTextStringSink Sink{ Result };
+    WriteLLMText(FBPResultLLMView(AnalysisResult), Sink);
+
     return Result;
 }
 
+int32 UBlueprintAnalyzerLibrary::CountLLMTextChars(const FBlueprintAnalysisResult& AnalysisResult)
+{
+    FBPLLMTextCountingSink Counter;
+    WriteLLMText(FBPResultLLMView(AnalysisResult), Counter);
+    return static_cast<int32>(FMath::Min<int64>(Counter.NumChars, MAX_int32));
+}
+
+int32 UBlueprintAnalyzerLibrary::EstimateLLMTextTokenCount(const FBlueprintAnalysisResult& AnalysisResult)
+{
+    // Same ratio as EstimateTokenCount(ExportToLLMText(...)), without building the text
+    return FMath::CeilToInt(CountLLMTextChars(AnalysisResult) / 3.5f);
+}
+
+int64 UBlueprintAnalyzerLibrary::CountSnapshotLLMTextChars(const FBPBlueprintSnapshot& Snapshot, const FBPTraceSet& Trace)
+{
+    BPA_STAGE_SCOPE(TokenCount);
+
+    if (!Snapshot.IsValid()) return 0;
+
+    const FString AnalysisTimestamp = FDateTime::Now().ToString();
+    FBPLLMTextCountingSink Counter;
+    WriteLLMText(FBPSnapshotLLMView{ Snapshot, Trace, AnalysisTimestamp }, Counter);
+    return Counter.NumChars;
+}
+
 bool UBlueprintAnalyzerLibrary::SaveAnalysisToFile(const FBlueprintAnalysisResult& AnalysisResult, const FString& FilePath, const FString& Format)
 {
-    FString Content;
-    
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::SaveAnalysisToFile);
+
     if (Format.ToUpper() == TEXT("JSON"))
     {
-        Content = ExportToJSON(AnalysisResult);
+        return WriteJsonToFile(FilePath, [&AnalysisResult](auto& Writer) { WriteAnalysisJson(Writer, AnalysisResult); });
     }
-    else
+
+    if (Format.ToUpper() == TEXT("BINARY"))
     {
-        Content = ExportToLLMText(AnalysisResult);
+        return FBPBinaryFormat::SaveToFile(AnalysisResult, FilePath);
     }
-    
-    return FFileHelper::SaveStringToFile(Content, *FilePath);
+
+    return FFileHelper::SaveStringToFile(ExportToLLMText(AnalysisResult), *FilePath);
+}
+
+bool UBlueprintAnalyzerLibrary::SavePerformanceReportToFile(const FBPPerformanceReport& Report, const FString& FilePath, const FString& Format)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::SavePerformanceReportToFile);
+
+    if (Format.ToUpper() == TEXT("JSON"))
+    {
+        return WriteJsonToFile(FilePath, [&Report](auto& Writer) { WritePerformanceReportJson(Writer, Report); });
+    }
+
+    return FFileHelper::SaveStringToFile(ExportPerformanceReportToLLMText(Report), *FilePath);
+}
+
+bool UBlueprintAnalyzerLibrary::SaveProjectAnalysisToFile(const FBPProjectAnalysis& Analysis, const FString& FilePath, const FString& Format)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::SaveProjectAnalysisToFile);
+
+    if (Format.ToUpper() == TEXT("JSON"))
+    {
+        return WriteJsonToFile(FilePath, [&Analysis](auto& Writer) { WriteProjectAnalysisJson(Writer, Analysis); });
+    }
+
+    if (Format.ToUpper() == TEXT("BINARY"))
+    {
+        return FBPBinaryFormat::SaveToFile(Analysis, FilePath);
+    }
+
+    return FFileHelper::SaveStringToFile(ExportProjectAnalysisToLLMText(Analysis), *FilePath);
+}
+
+bool UBlueprintAnalyzerLibrary::LoadAnalysisFromFile(const FString& FilePath, FBlueprintAnalysisResult& OutAnalysisResult)
+{
+    return FBPBinaryFormat::LoadFromFile(FilePath, OutAnalysisResult);
+}
+
+bool UBlueprintAnalyzerLibrary::LoadProjectAnalysisFromFile(const FString& FilePath, FBPProjectAnalysis& OutAnalysis)
+{
+    return FBPBinaryFormat::LoadFromFile(FilePath, OutAnalysis);
 }
 
 // New Widget Blueprint Analysis Functions Implementation
 FWidgetOptimizationReport UBlueprintAnalyzerLibrary::AnalyzeWidgetBlueprint(UBlueprint* WidgetBlueprint)
 {
+    BPA_STAGE_SCOPE(WidgetAnalysis);
+
     FWidgetOptimizationReport Report;
     
     if (!WidgetBlueprint)
@@ -2077,66 +2107,62 @@ TArray<FString> UBlueprintAnalyzerLibrary::GetBoundProperties(UWidget* Widget)
     return BoundProperties;
 }
 
-FString UBlueprintAnalyzerLibrary::ExportWidgetAnalysisToJSON(const FWidgetOptimizationReport& Report)
+template<typename JsonWriterType>
+static void WriteWidgetAnalysisJson(JsonWriterType& Writer, const FWidgetOptimizationReport& Report)
 {
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-    
-    RootObject->SetStringField(TEXT("WidgetBlueprintName"), Report.WidgetBlueprintName);
-    RootObject->SetStringField(TEXT("AnalysisTimestamp"), Report.AnalysisTimestamp);
-    RootObject->SetNumberField(TEXT("TotalWidgets"), Report.TotalWidgets);
-    RootObject->SetNumberField(TEXT("MaxDepth"), Report.MaxDepth);
-    RootObject->SetNumberField(TEXT("TotalBindings"), Report.TotalBindings);
-    RootObject->SetNumberField(TEXT("EstimatedMemoryUsage"), Report.EstimatedMemoryUsage);
-    RootObject->SetNumberField(TEXT("OptimizationScore"), Report.OptimizationScore);
+    Writer.WriteObjectStart();
+    Writer.WriteValue(TEXT("WidgetBlueprintName"), Report.WidgetBlueprintName);
+    Writer.WriteValue(TEXT("AnalysisTimestamp"), Report.AnalysisTimestamp);
+    Writer.WriteValue(TEXT("TotalWidgets"), Report.TotalWidgets);
+    Writer.WriteValue(TEXT("MaxDepth"), Report.MaxDepth);
+    Writer.WriteValue(TEXT("TotalBindings"), Report.TotalBindings);
+    Writer.WriteValue(TEXT("EstimatedMemoryUsage"), static_cast<double>(Report.EstimatedMemoryUsage));
+    Writer.WriteValue(TEXT("OptimizationScore"), Report.OptimizationScore);
 
     // Widget Hierarchy
-    TArray<TSharedPtr<FJsonValue>> HierarchyArray;
+    Writer.WriteArrayStart(TEXT("WidgetHierarchy"));
     for (const FWidgetHierarchyInfo& WidgetInfo : Report.WidgetHierarchy)
     {
-        TSharedPtr<FJsonObject> WidgetObject = MakeShareable(new FJsonObject);
-        WidgetObject->SetStringField(TEXT("WidgetName"), WidgetInfo.WidgetName);
-        WidgetObject->SetStringField(TEXT("WidgetType"), WidgetInfo.WidgetType);
-        WidgetObject->SetNumberField(TEXT("Depth"), WidgetInfo.Depth);
-        WidgetObject->SetNumberField(TEXT("ChildrenCount"), WidgetInfo.ChildrenCount);
-        WidgetObject->SetBoolField(TEXT("HasBindings"), WidgetInfo.bHasBindings);
-        
-        TArray<TSharedPtr<FJsonValue>> PropertiesArray;
-        for (const FString& Property : WidgetInfo.BoundProperties)
-        {
-            PropertiesArray.Add(MakeShareable(new FJsonValueString(Property)));
-        }
-        WidgetObject->SetArrayField(TEXT("BoundProperties"), PropertiesArray);
-        
-        HierarchyArray.Add(MakeShareable(new FJsonValueObject(WidgetObject)));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("WidgetName"), WidgetInfo.WidgetName);
+        Writer.WriteValue(TEXT("WidgetType"), WidgetInfo.WidgetType);
+        Writer.WriteValue(TEXT("Depth"), WidgetInfo.Depth);
+        Writer.WriteValue(TEXT("ChildrenCount"), WidgetInfo.ChildrenCount);
+        Writer.WriteValue(TEXT("HasBindings"), WidgetInfo.bHasBindings);
+        WriteStringArrayJson(Writer, TEXT("BoundProperties"), WidgetInfo.BoundProperties);
+        Writer.WriteObjectEnd();
     }
-    RootObject->SetArrayField(TEXT("WidgetHierarchy"), HierarchyArray);
+    Writer.WriteArrayEnd();
 
     // Optimization Issues
-    TArray<TSharedPtr<FJsonValue>> IssuesArray;
+    Writer.WriteArrayStart(TEXT("OptimizationIssues"));
     for (const FWidgetOptimizationIssue& Issue : Report.OptimizationIssues)
     {
-        TSharedPtr<FJsonObject> IssueObject = MakeShareable(new FJsonObject);
-        IssueObject->SetStringField(TEXT("IssueType"), Issue.IssueType);
-        IssueObject->SetStringField(TEXT("Description"), Issue.Description);
-        IssueObject->SetStringField(TEXT("Recommendation"), Issue.Recommendation);
-        IssueObject->SetStringField(TEXT("Severity"), 
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("IssueType"), Issue.IssueType);
+        Writer.WriteValue(TEXT("Description"), Issue.Description);
+        Writer.WriteValue(TEXT("Recommendation"), Issue.Recommendation);
+        Writer.WriteValue(TEXT("Severity"), FString(
             Issue.Severity == EWidgetOptimizationSeverity::Critical ? TEXT("Critical") :
-            Issue.Severity == EWidgetOptimizationSeverity::Warning ? TEXT("Warning") : TEXT("Info"));
-        IssueObject->SetStringField(TEXT("WidgetPath"), Issue.WidgetPath);
-        
-        IssuesArray.Add(MakeShareable(new FJsonValueObject(IssueObject)));
+            Issue.Severity == EWidgetOptimizationSeverity::Warning ? TEXT("Warning") : TEXT("Info")));
+        Writer.WriteValue(TEXT("WidgetPath"), Issue.WidgetPath);
+        Writer.WriteObjectEnd();
     }
-    RootObject->SetArrayField(TEXT("OptimizationIssues"), IssuesArray);
-
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
+    Writer.WriteArrayEnd();
+    Writer.WriteObjectEnd();
+}
 
-    return OutputString;
+FString UBlueprintAnalyzerLibrary::ExportWidgetAnalysisToJSON(const FWidgetOptimizationReport& Report)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::ExportWidgetAnalysisToJSON);
+    return WriteJsonToString([&Report](auto& Writer) { WriteWidgetAnalysisJson(Writer, Report); });
 }
 
 FString UBlueprintAnalyzerLibrary::ExportWidgetAnalysisToLLMText(const FWidgetOptimizationReport& Report)
 {
+    BPA_STAGE_SCOPE(ExportLLMText);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::ExportWidgetAnalysisToLLMText);
+
     FString Result;
     
     Result += FString::Printf(TEXT("Widget Blueprint Optimization Report: %s\n"), *Report.WidgetBlueprintName);
@@ -2186,18 +2212,14 @@ FString UBlueprintAnalyzerLibrary::ExportWidgetAnalysisToLLMText(const FWidgetOp
 
 bool UBlueprintAnalyzerLibrary::SaveWidgetAnalysisToFile(const FWidgetOptimizationReport& Report, const FString& FilePath, const FString& Format)
 {
-    FString Content;
-    
+    TRACE_CPUPROFILER_EVENT_SCOPE(UBlueprintAnalyzerLibrary::SaveWidgetAnalysisToFile);
+
     if (Format.ToUpper() == TEXT("JSON"))
     {
-        Content = ExportWidgetAnalysisToJSON(Report);
-    }
-    else
-    {
-        Content = ExportWidgetAnalysisToLLMText(Report);
+        return WriteJsonToFile(FilePath, [&Report](auto& Writer) { WriteWidgetAnalysisJson(Writer, Report); });
     }
-    
-    return FFileHelper::SaveStringToFile(Content, *FilePath);
+
+    return FFileHelper::SaveStringToFile(ExportWidgetAnalysisToLLMText(Report), *FilePath);
 }
 
 FString UBlueprintAnalyzerLibrary::GenerateOptimizedWidgetCode(const FWidgetOptimizationReport& Report)
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerMacroCache.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "UObject/Package.h"
+
+FBPMacroCache& FBPMacroCache::Get()
+{
+    static FBPMacroCache Instance;
+    return Instance;
+}
+
+TSharedRef<const FBPMacroSummary> FBPMacroCache::FindOrSummarize(UEdGraph* MacroGraph)
+{
+    check(IsInGameThread());
+    check(MacroGraph);
+
+    if (const TSharedRef<const FBPMacroSummary>* Existing = Summaries.Find(MacroGraph))
+    {
+        return *Existing;
+    }
+
+    TSharedRef<FBPMacroSummary> Summary = MakeShared<FBPMacroSummary>();
+    Summary->MacroName = MacroGraph->GetName();
+    Summary->Packages.Add(MacroGraph->GetOutermost()->GetFName());
+
+    UBlueprint* MacroBlueprint = MacroGraph->GetTypedOuter<UBlueprint>();
+    if (!MacroBlueprint || InProgress.Contains(MacroGraph))
+    {
+        return Summary;
+    }
+
+    // Nested macro instances are summarized (and cached) while this graph is captured
+    InProgress.Add(MacroGraph);
+    const FBPBlueprintSnapshot Snapshot = FBPSnapshotAnalyzer::CaptureGraph(MacroBlueprint, MacroGraph, EBPGraphKind::Macro);
+    InProgress.Remove(MacroGraph);
+
+    FBPSnapshotAnalyzer::SummarizeMacro(Snapshot, *Summary);
+    Summaries.Add(MacroGraph, Summary);
+    return Summary;
+}
+
+void FBPMacroCache::InvalidateBlueprint(const UBlueprint* Blueprint)
+{
+    check(IsInGameThread());
+
+    if (Blueprint && Blueprint->MacroGraphs.Num() > 0)
+    {
+        Reset();
+    }
+}
+
+void FBPMacroCache::Reset()
+{
+    check(IsInGameThread());
+
+    Summaries.Reset();
+}
@@ -2,6 +2,8 @@
 
 #include "BlueprintAnalyzerMenuExtension.h"
 #include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerFolderJob.h"
+#include "BlueprintAnalyzerSessionCache.h"
 #include "Engine/Blueprint.h"
 #include "Blueprint/UserWidget.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -17,6 +19,17 @@
 #include "Widgets/SWindow.h"
 #include "Misc/FileHelper.h"
 
+// Only one background folder analysis runs at a time
+static TWeakPtr<FBPFolderAnalysisJob> ActiveFolderJob;
+
+// Menus only exist in the editor, where the subsystem always does
+static UBlueprintAnalyzerSessionCache& GetSessionCache()
+{
+    UBlueprintAnalyzerSessionCache* Cache = UBlueprintAnalyzerSessionCache::Get();
+    check(Cache);
+    return *Cache;
+}
+
 void FBlueprintAnalyzerMenuExtension::Initialize()
 {
     RegisterMenuExtensions();
@@ -24,7 +37,10 @@ void FBlueprintAnalyzerMenuExtension::Initialize()
 
 void FBlueprintAnalyzerMenuExtension::Shutdown()
 {
-    // Cleanup
+    if (TSharedPtr<FBPFolderAnalysisJob> Job = ActiveFolderJob.Pin())
+    {
+        Job->Cancel();
+    }
 }
 
 void FBlueprintAnalyzerMenuExtension::RegisterMenuExtensions()
@@ -53,6 +69,13 @@ void FBlueprintAnalyzerMenuExtension::RegisterMenuExtensions()
                     FSlateIcon(),
                     FUIAction(FExecuteAction::CreateStatic(&FBlueprintAnalyzerMenuExtension::ExecuteAnalyzeFolder))
                 );
+                ProjectSection.AddMenuEntry(
+                    "QuickScanFolder",
+                    FText::FromString("Quick Scan Folder"),
+                    FText::FromString("Summarize Blueprints from asset registry data without loading them"),
+                    FSlateIcon(),
+                    FUIAction(FExecuteAction::CreateStatic(&FBlueprintAnalyzerMenuExtension::ExecuteQuickScanFolder))
+                );
                 ProjectSection.AddMenuEntry(
                     "ExportProjectToJSON",
                     FText::FromString("Export Project Analysis to JSON"),
@@ -175,7 +198,7 @@ void FBlueprintAnalyzerMenuExtension::ExecuteAnalyzeBlueprint()
         return;
     }
 
-    FBlueprintAnalysisResult AnalysisResult = UBlueprintAnalyzerLibrary::AnalyzeBlueprint(SelectedBlueprint);
+    FBlueprintAnalysisResult AnalysisResult = GetSessionCache().GetBlueprintAnalysis(SelectedBlueprint);
 
     const FBPAnalyzerMetadata& Meta = AnalysisResult.Metadata;
     FString Message;
@@ -210,7 +233,7 @@ void FBlueprintAnalyzerMenuExtension::ExecuteExportToJSON()
     
     if (!SavePath.IsEmpty())
     {
-        FBlueprintAnalysisResult AnalysisResult = UBlueprintAnalyzerLibrary::AnalyzeBlueprint(SelectedBlueprint);
+        FBlueprintAnalysisResult AnalysisResult = GetSessionCache().GetBlueprintAnalysis(SelectedBlueprint);
         bool bSuccess = UBlueprintAnalyzerLibrary::SaveAnalysisToFile(AnalysisResult, SavePath, TEXT("JSON"));
         
         if (bSuccess)
@@ -238,7 +261,7 @@ void FBlueprintAnalyzerMenuExtension::ExecuteExportToLLMText()
     
     if (!SavePath.IsEmpty())
     {
-        FBlueprintAnalysisResult AnalysisResult = UBlueprintAnalyzerLibrary::AnalyzeBlueprint(SelectedBlueprint);
+        FBlueprintAnalysisResult AnalysisResult = GetSessionCache().GetBlueprintAnalysis(SelectedBlueprint);
         bool bSuccess = UBlueprintAnalyzerLibrary::SaveAnalysisToFile(AnalysisResult, SavePath, TEXT("TEXT"));
         
         if (bSuccess)
@@ -267,7 +290,7 @@ void FBlueprintAnalyzerMenuExtension::ExecuteAnalyzeWidgetBlueprint()
         return;
     }
 
-    FWidgetOptimizationReport Report = UBlueprintAnalyzerLibrary::AnalyzeWidgetBlueprint(SelectedBlueprint);
+    FWidgetOptimizationReport Report = GetSessionCache().GetWidgetReport(SelectedBlueprint);
     
     FString SeverityText;
     if (Report.OptimizationScore >= 90)
@@ -330,7 +353,7 @@ void FBlueprintAnalyzerMenuExtension::ExecuteExportWidgetToJSON()
     
     if (!SavePath.IsEmpty())
     {
-        FWidgetOptimizationReport Report = UBlueprintAnalyzerLibrary::AnalyzeWidgetBlueprint(SelectedBlueprint);
+        FWidgetOptimizationReport Report = GetSessionCache().GetWidgetReport(SelectedBlueprint);
         bool bSuccess = UBlueprintAnalyzerLibrary::SaveWidgetAnalysisToFile(Report, SavePath, TEXT("JSON"));
         
         if (bSuccess)
@@ -364,7 +387,7 @@ void FBlueprintAnalyzerMenuExtension::ExecuteExportWidgetToLLMText()
     
     if (!SavePath.IsEmpty())
     {
-        FWidgetOptimizationReport Report = UBlueprintAnalyzerLibrary::AnalyzeWidgetBlueprint(SelectedBlueprint);
+        FWidgetOptimizationReport Report = GetSessionCache().GetWidgetReport(SelectedBlueprint);
         bool bSuccess = UBlueprintAnalyzerLibrary::SaveWidgetAnalysisToFile(Report, SavePath, TEXT("TEXT"));
         
         if (bSuccess)
@@ -423,7 +446,7 @@ void FBlueprintAnalyzerMenuExtension::ExecuteAnalyzeBlueprintPerformance()
         return;
     }
 
-    FBPPerformanceReport Report = UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(SelectedBlueprint);
+    FBPPerformanceReport Report = GetSessionCache().GetPerformanceReport(SelectedBlueprint);
 
     FString Grade;
     if (Report.PerformanceScore >= 90) Grade = TEXT("Excellent");
@@ -440,6 +463,7 @@ void FBlueprintAnalyzerMenuExtension::ExecuteAnalyzeBlueprintPerformance()
     Message += FString::Printf(TEXT("Casts: %d\n"), Report.CastCount);
     Message += FString::Printf(TEXT("Tick downstream: %d nodes\n"), Report.TickNodeCount);
     Message += FString::Printf(TEXT("BeginPlay downstream: %d nodes\n"), Report.BeginPlayNodeCount);
+    Message += FString::Printf(TEXT("Estimated Tick cost: %.0f units/frame\n"), Report.EstimatedTickCost);
     Message += FString::Printf(TEXT("Issues Found: %d"), Report.Issues.Num());
 
     FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
@@ -458,9 +482,8 @@ void FBlueprintAnalyzerMenuExtension::ExecuteExportPerformanceToJSON()
     FString SavePath = ShowSaveFileDialog(DefaultFilename, TEXT("JSON Files (*.json)|*.json"));
     if (SavePath.IsEmpty()) return;
 
-    FBPPerformanceReport Report = UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(SelectedBlueprint);
-    const FString Content = UBlueprintAnalyzerLibrary::ExportPerformanceReportToJSON(Report);
-    const bool bSuccess = FFileHelper::SaveStringToFile(Content, *SavePath);
+    FBPPerformanceReport Report = GetSessionCache().GetPerformanceReport(SelectedBlueprint);
+    const bool bSuccess = UBlueprintAnalyzerLibrary::SavePerformanceReportToFile(Report, SavePath, TEXT("JSON"));
 
     FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(bSuccess
         ? FString::Printf(TEXT("Performance report exported to: %s"), *SavePath)
@@ -480,9 +503,8 @@ void FBlueprintAnalyzerMenuExtension::ExecuteExportPerformanceToLLMText()
     FString SavePath = ShowSaveFileDialog(DefaultFilename, TEXT("Text Files (*.txt)|*.txt"));
     if (SavePath.IsEmpty()) return;
 
-    FBPPerformanceReport Report = UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(SelectedBlueprint);
-    const FString Content = UBlueprintAnalyzerLibrary::ExportPerformanceReportToLLMText(Report);
-    const bool bSuccess = FFileHelper::SaveStringToFile(Content, *SavePath);
+    FBPPerformanceReport Report = GetSessionCache().GetPerformanceReport(SelectedBlueprint);
+    const bool bSuccess = UBlueprintAnalyzerLibrary::SavePerformanceReportToFile(Report, SavePath, TEXT("TEXT"));
 
     FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(bSuccess
         ? FString::Printf(TEXT("LLM-friendly performance report exported to: %s"), *SavePath)
@@ -542,6 +564,41 @@ FString FBlueprintAnalyzerMenuExtension::GetSelectedFolderPath()
     return RawPath;
 }
 
+// Calls OnFinished with the session's cached folder result, or runs the analysis in the background
+// and calls it with the (possibly partial) result
+static bool StartFolderJob(const FString& FolderPath, TFunction<void(const FBPProjectAnalysis&, bool)> OnFinished)
+{
+    if (const FBPProjectAnalysis* Cached = GetSessionCache().FindFolderAnalysis(FolderPath))
+    {
+        // Copy: the callback may open a dialog, and edits made meanwhile invalidate the entry
+        const FBPProjectAnalysis Analysis = *Cached;
+        OnFinished(Analysis, false);
+        return true;
+    }
+
+    if (TSharedPtr<FBPFolderAnalysisJob> Running = ActiveFolderJob.Pin())
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(FString::Printf(
+            TEXT("A folder analysis of %s is still running (%d / %d Blueprints). Cancel it from its notification or wait for it to finish."),
+            *Running->GetFolderPath(), Running->GetNumCompleted(), Running->GetNumAssets())), FText::FromString("Blueprint Analyzer"));
+        return false;
+    }
+
+    // Before the job starts, so edits made while its first assets load are seen
+    const uint64 CacheToken = GetSessionCache().BeginFolderAnalysis(FolderPath);
+    TSharedRef<FBPFolderAnalysisJob> Job = FBPFolderAnalysisJob::Start(FolderPath);
+    Job->OnFinished().AddLambda([OnFinished = MoveTemp(OnFinished), CacheToken](const FBPProjectAnalysis& Analysis, bool bCancelled)
+    {
+        if (!bCancelled)
+        {
+            GetSessionCache().StoreFolderAnalysis(Analysis, CacheToken);
+        }
+        OnFinished(Analysis, bCancelled);
+    });
+    ActiveFolderJob = Job;
+    return true;
+}
+
 void FBlueprintAnalyzerMenuExtension::ExecuteAnalyzeFolder()
 {
     const FString FolderPath = GetSelectedFolderPath();
@@ -551,14 +608,56 @@ void FBlueprintAnalyzerMenuExtension::ExecuteAnalyzeFolder()
         return;
     }
 
-    FBPProjectAnalysis Analysis = UBlueprintAnalyzerLibrary::AnalyzeFolder(FolderPath);
+    StartFolderJob(FolderPath, [](const FBPProjectAnalysis& Analysis, bool bCancelled)
+    {
+        FString Message;
+        Message += FString::Printf(TEXT("Project Analysis: %s\n"), *Analysis.FolderPath);
+        if (bCancelled)
+        {
+            Message += TEXT("(cancelled; partial results)\n");
+        }
+        Message += TEXT("\n");
+        Message += FString::Printf(TEXT("Blueprints: %d\n"), Analysis.BlueprintsAnalyzed);
+        Message += FString::Printf(TEXT("Total nodes: %d\n"), Analysis.TotalNodes);
+        Message += FString::Printf(TEXT("Average score: %.1f/100\n"), Analysis.AveragePerformanceScore);
+        Message += FString::Printf(TEXT("Dependencies: %d\n"), Analysis.Dependencies.Num());
+        Message += FString::Printf(TEXT("Circular chains: %d"), Analysis.CircularDependencyChains.Num());
+
+        FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
+    });
+}
+
+void FBlueprintAnalyzerMenuExtension::ExecuteQuickScanFolder()
+{
+    const FString FolderPath = GetSelectedFolderPath();
+    if (FolderPath.IsEmpty())
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FText::FromString("No folder selected."), FText::FromString("Blueprint Analyzer"));
+        return;
+    }
+
+    FBPProjectAnalysis Analysis = UBlueprintAnalyzerLibrary::QuickScanFolder(FolderPath);
+
+    int64 TotalDiskSize = 0;
+    const FBPBlueprintSummary* Largest = nullptr;
+    for (const FBPBlueprintSummary& Summary : Analysis.Summaries)
+    {
+        TotalDiskSize += Summary.PackageDiskSize;
+        if (!Largest || Summary.PackageDiskSize > Largest->PackageDiskSize)
+        {
+            Largest = &Summary;
+        }
+    }
 
     FString Message;
-    Message += FString::Printf(TEXT("Project Analysis: %s\n\n"), *Analysis.FolderPath);
+    Message += FString::Printf(TEXT("Quick Scan: %s\n\n"), *Analysis.FolderPath);
     Message += FString::Printf(TEXT("Blueprints: %d\n"), Analysis.BlueprintsAnalyzed);
-    Message += FString::Printf(TEXT("Total nodes: %d\n"), Analysis.TotalNodes);
-    Message += FString::Printf(TEXT("Average score: %.1f/100\n"), Analysis.AveragePerformanceScore);
-    Message += FString::Printf(TEXT("Dependencies: %d\n"), Analysis.Dependencies.Num());
+    Message += FString::Printf(TEXT("Total package size: %.1f MB\n"), TotalDiskSize / (1024.0 * 1024.0));
+    if (Largest)
+    {
+        Message += FString::Printf(TEXT("Largest: %s (%lld KB)\n"), *Largest->BlueprintName, Largest->PackageDiskSize / 1024);
+    }
+    Message += FString::Printf(TEXT("Package dependencies: %d\n"), Analysis.Dependencies.Num());
     Message += FString::Printf(TEXT("Circular chains: %d"), Analysis.CircularDependencyChains.Num());
 
     FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
@@ -576,13 +675,17 @@ void FBlueprintAnalyzerMenuExtension::ExecuteExportProjectToJSON()
     FString SavePath = ShowSaveFileDialog(TEXT("ProjectAnalysis.json"), TEXT("JSON Files (*.json)|*.json"));
     if (SavePath.IsEmpty()) return;
 
-    FBPProjectAnalysis Analysis = UBlueprintAnalyzerLibrary::AnalyzeFolder(FolderPath);
-    const FString Content = UBlueprintAnalyzerLibrary::ExportProjectAnalysisToJSON(Analysis);
-    const bool bSuccess = FFileHelper::SaveStringToFile(Content, *SavePath);
+    StartFolderJob(FolderPath, [SavePath](const FBPProjectAnalysis& Analysis, bool bCancelled)
+    {
+        // A cancelled run would silently export an incomplete folder
+        if (bCancelled) return;
 
-    FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(bSuccess
-        ? FString::Printf(TEXT("Project analysis exported to: %s"), *SavePath)
-        : TEXT("Failed to export project analysis.")));
+        const bool bSuccess = UBlueprintAnalyzerLibrary::SaveProjectAnalysisToFile(Analysis, SavePath, TEXT("JSON"));
+
+        FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(bSuccess
+            ? FString::Printf(TEXT("Project analysis exported to: %s"), *SavePath)
+            : TEXT("Failed to export project analysis.")));
+    });
 }
 
 void FBlueprintAnalyzerMenuExtension::ExecuteExportProjectToLLMText()
@@ -597,13 +700,16 @@ void FBlueprintAnalyzerMenuExtension::ExecuteExportProjectToLLMText()
     FString SavePath = ShowSaveFileDialog(TEXT("ProjectAnalysis_LLM.txt"), TEXT("Text Files (*.txt)|*.txt"));
     if (SavePath.IsEmpty()) return;
 
-    FBPProjectAnalysis Analysis = UBlueprintAnalyzerLibrary::AnalyzeFolder(FolderPath);
-    const FString Content = UBlueprintAnalyzerLibrary::ExportProjectAnalysisToLLMText(Analysis);
-    const bool bSuccess = FFileHelper::SaveStringToFile(Content, *SavePath);
+    StartFolderJob(FolderPath, [SavePath](const FBPProjectAnalysis& Analysis, bool bCancelled)
+    {
+        if (bCancelled) return;
 
-    FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(bSuccess
-        ? FString::Printf(TEXT("LLM-friendly project analysis exported to: %s"), *SavePath)
-        : TEXT("Failed to export project analysis.")));
+        const bool bSuccess = UBlueprintAnalyzerLibrary::SaveProjectAnalysisToFile(Analysis, SavePath, TEXT("TEXT"));
+
+        FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(bSuccess
+            ? FString::Printf(TEXT("LLM-friendly project analysis exported to: %s"), *SavePath)
+            : TEXT("Failed to export project analysis.")));
+    });
 }
 
 UBlueprint* FBlueprintAnalyzerMenuExtension::GetSelectedBlueprint()
@@ -0,0 +1,397 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerPipeline.h"
+#include "BlueprintAnalyzerSnapshot.h"
+#include "BlueprintAnalyzerCache.h"
+#include "BlueprintAnalyzerRegistryScan.h"
+#include "BlueprintAnalyzerIndex.h"
+#include "Engine/Blueprint.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/DateTime.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+// Game thread budget for advancing async loads between steps, in seconds
+static constexpr double PrefetchPumpSeconds = 0.002;
+
+FBPAnalysisPipeline::FBPAnalysisPipeline(const FString& InFolderPath, const TArray<FAssetData>& InAssets, const FBPFolderAnalysisOptions& InOptions)
+    : FolderPath(InFolderPath)
+    , Assets(InAssets)
+    , Options(InOptions)
+    , Slots(MakeShared<TArray<FPrefetchSlot>>())
+{
+    AnalysisTimestamp = FDateTime::Now().ToString();
+    TraceLimits = FBPTraceLimits::FromConsoleVariables();
+
+    if (Options.bParallel)
+    {
+        WorkerCount = Options.WorkerCount > 0
+            ? Options.WorkerCount
+            : FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+    }
+
+    Results.SetNum(Assets.Num());
+    SavedHashes.SetNum(Assets.Num());
+    MacroPackageHashes.SetNum(Assets.Num());
+    MacroPackagesSaved.Init(false, Assets.Num());
+    Slots->SetNum(Assets.Num());
+    SampleWorkingSet();
+}
+
+bool FBPAnalysisPipeline::Step()
+{
+    check(IsInGameThread());
+
+    if (NextAsset >= Assets.Num()) return false;
+
+    const int32 AssetIndex = NextAsset++;
+    const FAssetData& AssetData = Assets[AssetIndex];
+
+    PrefetchAhead(AssetIndex);
+
+    if ((*Slots)[AssetIndex].bCacheHit)
+    {
+        return NextAsset < Assets.Num();
+    }
+
+    if (UBlueprint* BP = WaitForBlueprint(AssetIndex))
+    {
+        FBPBlueprintSnapshot Snapshot = FBPSnapshotAnalyzer::Capture(BP);
+        Snapshot.BlueprintPath = AssetData.GetObjectPathString();
+
+        if (Options.bUseCache)
+        {
+            // The package may have been edited while it was queued; what was captured is not what was saved
+            if (BP->GetOutermost()->IsDirty())
+            {
+                SavedHashes[AssetIndex] = FIoHash::Zero;
+            }
+
+            TArray<FName> MacroPackages = Snapshot.GetMacroPackages();
+            MacroPackages.Remove(AssetData.PackageName);
+            MacroPackagesSaved[AssetIndex] = FBPAnalysisCache::GetPackageSavedHashes(MacroPackages, MacroPackageHashes[AssetIndex]);
+        }
+
+        if (WorkerCount <= 1)
+        {
+            CompleteAsset(AssetIndex, AnalyzeSnapshot(Snapshot, TraceLimits));
+        }
+        else
+        {
+            // Keep at most WorkerCount snapshots alive; this bounds both concurrency and memory
+            while (InFlight.Num() >= WorkerCount)
+            {
+                RetireOldest();
+            }
+
+            InFlight.Emplace(AssetIndex, UE::Tasks::Launch(UE_SOURCE_LOCATION,
+                [Snapshot = MoveTemp(Snapshot), Limits = TraceLimits]()
+                {
+                    return AnalyzeSnapshot(Snapshot, Limits);
+                }));
+        }
+
+        // Snapshot taken; the package is now only held by whatever else references it
+        (*Slots)[AssetIndex].Package.Reset();
+
+        NumLoadedInChunk++;
+        SampleWorkingSet();
+        if (ShouldEndChunk())
+        {
+            EndChunk();
+        }
+    }
+    else
+    {
+        // Not a Blueprint or failed to load; nothing will be analyzed for it, so don't keep it alive
+        (*Slots)[AssetIndex].Package.Reset();
+        NumCompleted++;
+    }
+
+    return NextAsset < Assets.Num();
+}
+
+void FBPAnalysisPipeline::PrefetchAhead(int32 CurrentAsset)
+{
+    const int32 WindowEnd = FMath::Min(Assets.Num(), CurrentAsset + FMath::Max(Options.PrefetchWindow, 0) + 1);
+
+    for (; NextPrefetch < WindowEnd; ++NextPrefetch)
+    {
+        const int32 AssetIndex = NextPrefetch;
+        const FAssetData& AssetData = Assets[AssetIndex];
+        FPrefetchSlot& Slot = (*Slots)[AssetIndex];
+
+        // Resolve the cache before loading so unchanged packages are never requested
+        if (Options.bUseCache)
+        {
+            // Unsaved edits are not reflected in the saved hash; a zero hash neither finds nor stores
+            const UPackage* Package = FindPackage(nullptr, *AssetData.PackageName.ToString());
+            SavedHashes[AssetIndex] = Package && Package->IsDirty() ? FIoHash::Zero : FBPAnalysisCache::GetPackageSavedHash(AssetData.PackageName);
+
+            if (const FBPAnalysisCacheEntry* Cached = FBPAnalysisCache::Get().Find(AssetData.GetObjectPathString(), SavedHashes[AssetIndex], TraceLimits))
+            {
+                FAssetResult& Result = Results[AssetIndex];
+                Result.Summary = Cached->Summary;
+                Result.Dependencies = Cached->Dependencies;
+                if (!Options.IndexFilePath.IsEmpty())
+                {
+                    Result.IndexRows = Cached->IndexRows;
+                }
+                Result.bValid = true;
+                Slot.bCacheHit = true;
+                NumCacheHits++;
+                NumCompleted++;
+                if (OnAssetCompleted)
+                {
+                    OnAssetCompleted(Result.Summary);
+                }
+                continue;
+            }
+        }
+
+        if (Options.PrefetchWindow <= 0 || AssetData.IsAssetLoaded()) continue;
+
+        TWeakPtr<TArray<FPrefetchSlot>> WeakSlots = Slots;
+        Slot.RequestId = LoadPackageAsync(AssetData.PackageName.ToString(),
+            FLoadPackageAsyncDelegate::CreateLambda([WeakSlots, AssetIndex](const FName&, UPackage* LoadedPackage, EAsyncLoadingResult::Type)
+            {
+                if (TSharedPtr<TArray<FPrefetchSlot>> PinnedSlots = WeakSlots.Pin())
+                {
+                    FPrefetchSlot& LoadedSlot = (*PinnedSlots)[AssetIndex];
+                    LoadedSlot.bLoadFinished = true;
+                    LoadedSlot.Package.Reset(LoadedPackage);
+                }
+            }));
+        PrefetchedPackages++;
+    }
+
+    // Commandlets never tick the engine; give queued loads a slice of the game thread
+    if (Options.PrefetchWindow > 0 && IsAsyncLoading())
+    {
+        ProcessAsyncLoading(true, false, PrefetchPumpSeconds);
+    }
+}
+
+UBlueprint* FBPAnalysisPipeline::WaitForBlueprint(int32 AssetIndex)
+{
+    BPA_STAGE_SCOPE(Load);
+
+    const FAssetData& AssetData = Assets[AssetIndex];
+    FPrefetchSlot& Slot = (*Slots)[AssetIndex];
+
+    // A request id means the asset object may exist but still be mid-load; trust the callback
+    const bool bStalled = Slot.RequestId != INDEX_NONE ? !Slot.bLoadFinished : !AssetData.IsAssetLoaded();
+    const double StallStartTime = FPlatformTime::Seconds();
+
+    if (bStalled && Slot.RequestId != INDEX_NONE)
+    {
+        FlushAsyncLoading(Slot.RequestId);
+    }
+
+    // Resolves the already loaded object, or loads synchronously when prefetching is off or failed
+    UBlueprint* BP = Cast<UBlueprint>(AssetData.GetAsset());
+
+    if (bStalled)
+    {
+        LoadStalls++;
+        LoadStallSeconds += FPlatformTime::Seconds() - StallStartTime;
+    }
+    return BP;
+}
+
+void FBPAnalysisPipeline::SampleWorkingSet()
+{
+    LastWorkingSetBytes = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+    PeakWorkingSetBytes = FMath::Max(PeakWorkingSetBytes, LastWorkingSetBytes);
+}
+
+bool FBPAnalysisPipeline::ShouldEndChunk() const
+{
+    if (NumLoadedInChunk == 0) return false;
+    if (Options.ChunkSize > 0 && NumLoadedInChunk >= Options.ChunkSize) return true;
+    return Options.MemoryCeilingMB > 0 && LastWorkingSetBytes > int64(Options.MemoryCeilingMB) * 1024 * 1024;
+}
+
+void FBPAnalysisPipeline::EndChunk()
+{
+    check(IsInGameThread());
+
+    // Snapshots hold no UObject pointers, so workers keep running while the packages this chunk
+    // loaded (and their hard-reference closure) are collected. Packages the user already had
+    // open stay referenced and are left alone, as do prefetched packages not analyzed yet.
+    const int64 BeforeBytes = LastWorkingSetBytes;
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+    NumLoadedInChunk = 0;
+    ChunkCollections++;
+    SampleWorkingSet();
+
+    UE_LOG(LogTemp, Log, TEXT("BlueprintAnalyzer: chunk %d released (%d / %d assets, %lld MB -> %lld MB)"),
+        ChunkCollections, NextAsset, Assets.Num(), BeforeBytes / (1024 * 1024), LastWorkingSetBytes / (1024 * 1024));
+
+    if (Options.MemoryCeilingMB > 0 && LastWorkingSetBytes > int64(Options.MemoryCeilingMB) * 1024 * 1024 && !bWarnedAboveCeiling)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: still using %lld MB after garbage collection (ceiling %d MB); memory is held outside the analyzed packages"),
+            LastWorkingSetBytes / (1024 * 1024), Options.MemoryCeilingMB);
+        bWarnedAboveCeiling = true;
+    }
+}
+
+void FBPAnalysisPipeline::RetireOldest()
+{
+    if (InFlight.Num() == 0) return;
+
+    TPair<int32, UE::Tasks::TTask<FAssetResult>> Oldest = MoveTemp(InFlight[0]);
+    InFlight.RemoveAt(0);
+
+    CompleteAsset(Oldest.Key, MoveTemp(Oldest.Value.GetResult()));
+}
+
+void FBPAnalysisPipeline::CompleteAsset(int32 AssetIndex, FAssetResult&& Result)
+{
+    if (Options.bUseCache && Result.bValid && MacroPackagesSaved[AssetIndex])
+    {
+        FBPAnalysisCacheEntry Entry;
+        Entry.PackageSavedHash = SavedHashes[AssetIndex];
+        Entry.MacroPackageHashes = MoveTemp(MacroPackageHashes[AssetIndex]);
+        Entry.TraceLimits = TraceLimits;
+        Entry.Summary = Result.Summary;
+        Entry.PerformanceReport = MoveTemp(Result.PerformanceReport);
+        Entry.Dependencies = Result.Dependencies;
+        if (Options.IndexFilePath.IsEmpty())
+        {
+            Entry.IndexRows = MoveTemp(Result.IndexRows);
+        }
+        else
+        {
+            Entry.IndexRows = Result.IndexRows;
+        }
+        FBPAnalysisCache::Get().Store(Assets[AssetIndex].GetObjectPathString(), MoveTemp(Entry));
+    }
+
+    // Only the summary and dependencies reach the project result; drop the full report now
+    Result.PerformanceReport = FBPPerformanceReport();
+    if (Options.IndexFilePath.IsEmpty())
+    {
+        Result.IndexRows = FBPIndexRows();
+    }
+    Results[AssetIndex] = MoveTemp(Result);
+
+    NumCompleted++;
+    if (OnAssetCompleted && Results[AssetIndex].bValid)
+    {
+        OnAssetCompleted(Results[AssetIndex].Summary);
+    }
+}
+
+FBPAnalysisPipeline::FAssetResult FBPAnalysisPipeline::AnalyzeSnapshot(const FBPBlueprintSnapshot& Snapshot, const FBPTraceLimits& Limits)
+{
+    FAssetResult Out;
+    if (!Snapshot.IsValid()) return Out;
+
+    FBPBlueprintSummary& Summary = Out.Summary;
+    Summary.BlueprintName = Snapshot.BlueprintName;
+    Summary.BlueprintPath = Snapshot.BlueprintPath;
+    Summary.BlueprintType = Snapshot.BlueprintType;
+    Summary.ParentClass = Snapshot.Metadata.ParentClass;
+    Summary.ImplementedInterfaces = Snapshot.Metadata.ImplementedInterfaces;
+
+    // One walk over the snapshot feeds every per-asset pass
+    FBPSnapshotAnalysis Analysis = FBPSnapshotAnalyzer::AnalyzeAll(Snapshot, Limits);
+
+    Summary.NodeCount = Analysis.SummaryNodeCount;
+    Summary.PerformanceScore = Analysis.PerformanceReport.PerformanceScore;
+    Summary.EstimatedTickCost = Analysis.PerformanceReport.EstimatedTickCost;
+    for (const FBPPerformanceIssue& Issue : Analysis.PerformanceReport.Issues)
+    {
+        if (Issue.Severity == EBPPerformanceSeverity::Critical)
+        {
+            Summary.CriticalIssues++;
+        }
+    }
+
+    Summary.EstimatedTokenCount = FMath::CeilToInt(Analysis.LLMTextChars / 3.5f);
+
+    Out.PerformanceReport = MoveTemp(Analysis.PerformanceReport);
+    Out.Dependencies = MoveTemp(Analysis.Dependencies);
+    Out.IndexRows = FBPIndexRows::FromSnapshot(Snapshot, Analysis.Trace);
+    Out.bValid = true;
+
+    return Out;
+}
+
+FBPProjectAnalysis FBPAnalysisPipeline::Finish()
+{
+    check(IsInGameThread());
+
+    while (InFlight.Num() > 0)
+    {
+        RetireOldest();
+    }
+
+    if (Options.bUseCache)
+    {
+        FBPAnalysisCache::Get().Save();
+        UE_LOG(LogTemp, Log, TEXT("BlueprintAnalyzer: %d of %d Blueprints in %s served from cache"), NumCacheHits, Assets.Num(), *FolderPath);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("BlueprintAnalyzer: %d packages prefetched (window %d), %d loads stalled the pipeline for %.3f s"),
+        PrefetchedPackages, Options.PrefetchWindow, LoadStalls, LoadStallSeconds);
+
+    SampleWorkingSet();
+
+    FBPProjectAnalysis Result;
+    Result.FolderPath = FolderPath;
+    Result.AnalysisTimestamp = AnalysisTimestamp;
+    Result.PeakWorkingSetBytes = PeakWorkingSetBytes;
+    Result.ChunkCollections = ChunkCollections;
+    Result.PrefetchedPackages = PrefetchedPackages;
+    Result.LoadStalls = LoadStalls;
+    Result.LoadStallSeconds = static_cast<float>(LoadStallSeconds);
+
+    int32 ScoreSum = 0;
+    int32 NodeSum = 0;
+    FBPProjectIndexWriter IndexWriter;
+
+    for (int32 AssetIndex = 0; AssetIndex < Results.Num(); ++AssetIndex)
+    {
+        FAssetResult& AssetResult = Results[AssetIndex];
+        if (!AssetResult.bValid) continue;
+
+        // Referencer counts depend on other packages, so refresh them even for cached entries
+        FBPRegistryScan::FillPackageInfo(Assets[AssetIndex], AssetResult.Summary);
+
+        NodeSum += AssetResult.Summary.NodeCount;
+        ScoreSum += AssetResult.Summary.PerformanceScore;
+
+        if (!Options.IndexFilePath.IsEmpty())
+        {
+            IndexWriter.AddBlueprint(AssetResult.Summary, AssetResult.IndexRows, AssetResult.Dependencies);
+        }
+
+        Result.Dependencies.Append(MoveTemp(AssetResult.Dependencies));
+        Result.Summaries.Add(MoveTemp(AssetResult.Summary));
+        Result.BlueprintsAnalyzed++;
+    }
+    Results.Empty();
+
+    Result.TotalNodes = NodeSum;
+    Result.AveragePerformanceScore = Result.BlueprintsAnalyzed > 0
+        ? static_cast<float>(ScoreSum) / static_cast<float>(Result.BlueprintsAnalyzed)
+        : 100.0f;
+
+    UBlueprintAnalyzerLibrary::FindCircularDependencies(Result);
+
+    if (!Options.IndexFilePath.IsEmpty() && !IndexWriter.Save(Options.IndexFilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BlueprintAnalyzer: failed to write project index %s"), *Options.IndexFilePath);
+    }
+
+    if (FBPStageProfiler::IsEnabled())
+    {
+        Result.StageTimings = StageRun.GetTimings();
+    }
+
+    return Result;
+}
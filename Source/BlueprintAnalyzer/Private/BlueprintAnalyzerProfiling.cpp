@@ -0,0 +1,188 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerProfiling.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+DEFINE_STAT(STAT_BlueprintAnalyzer_Load);
+DEFINE_STAT(STAT_BlueprintAnalyzer_Metadata);
+DEFINE_STAT(STAT_BlueprintAnalyzer_GraphCapture);
+DEFINE_STAT(STAT_BlueprintAnalyzer_Tracing);
+DEFINE_STAT(STAT_BlueprintAnalyzer_Walk);
+DEFINE_STAT(STAT_BlueprintAnalyzer_TokenCount);
+DEFINE_STAT(STAT_BlueprintAnalyzer_WidgetAnalysis);
+DEFINE_STAT(STAT_BlueprintAnalyzer_ExportJSON);
+DEFINE_STAT(STAT_BlueprintAnalyzer_ExportLLMText);
+DEFINE_STAT(STAT_BlueprintAnalyzer_ExportBinary);
+DEFINE_STAT(STAT_BlueprintAnalyzer_ExportIndex);
+DEFINE_STAT(STAT_BlueprintAnalyzer_CycleDetection);
+
+LLM_DEFINE_TAG(BlueprintAnalyzer);
+
+static constexpr int32 NumStages = (int32)EBPAnalyzerStage::Num;
+
+static bool bProfilingEnabled = false;
+static FAutoConsoleVariableRef CVarProfile(
+    TEXT("BlueprintAnalyzer.Profile"),
+    bProfilingEnabled,
+    TEXT("Record per-stage wall time and memory into BlueprintAnalyzer reports (StageTimings)."));
+
+static std::atomic<uint64> StageCycles[NumStages];
+static std::atomic<uint32> StageCalls[NumStages];
+
+// Runs whose reports have not ended; each keeps its own memory peaks
+static FCriticalSection OpenRunsLock;
+static TArray<FBPStageProfiler::FRun*> OpenRuns;
+
+// Innermost open stage scope on this thread
+static thread_local FBPStageScope* CurrentStageScope = nullptr;
+
+// ============================================================
+// FBPStageProfiler
+// ============================================================
+
+bool FBPStageProfiler::IsEnabled()
+{
+    return bProfilingEnabled;
+}
+
+void FBPStageProfiler::SetEnabled(bool bEnabled)
+{
+    bProfilingEnabled = bEnabled;
+}
+
+void FBPStageProfiler::Add(EBPAnalyzerStage Stage, uint64 Cycles, uint32 Calls)
+{
+    check(Stage < EBPAnalyzerStage::Num);
+    StageCycles[(int32)Stage].fetch_add(Cycles, std::memory_order_relaxed);
+    StageCalls[(int32)Stage].fetch_add(Calls, std::memory_order_relaxed);
+}
+
+void FBPStageProfiler::AddNested(EBPAnalyzerStage Stage, uint64 Cycles, uint32 Calls)
+{
+    Add(Stage, Cycles, Calls);
+    if (CurrentStageScope)
+    {
+        CurrentStageScope->StartCycles += Cycles;
+    }
+}
+
+void FBPStageProfiler::SampleMemory(EBPAnalyzerStage Stage)
+{
+    check(Stage < EBPAnalyzerStage::Num);
+    const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+    FScopeLock Lock(&OpenRunsLock);
+    for (FRun* Run : OpenRuns)
+    {
+        uint64& Peak = Run->PeakUsedPhysical[(int32)Stage];
+        Peak = FMath::Max(Peak, UsedPhysical);
+    }
+}
+
+const TCHAR* FBPStageProfiler::GetStageName(EBPAnalyzerStage Stage)
+{
+    switch (Stage)
+    {
+    case EBPAnalyzerStage::Load:                 return TEXT("Load");
+    case EBPAnalyzerStage::Metadata:             return TEXT("Metadata");
+    case EBPAnalyzerStage::GraphCapture:         return TEXT("GraphCapture");
+    case EBPAnalyzerStage::NodeExtraction:       return TEXT("NodeExtraction");
+    case EBPAnalyzerStage::ConnectionExtraction: return TEXT("ConnectionExtraction");
+    case EBPAnalyzerStage::Tracing:              return TEXT("Tracing");
+    case EBPAnalyzerStage::PerfRules:            return TEXT("PerfRules");
+    case EBPAnalyzerStage::DependencyExtraction: return TEXT("DependencyExtraction");
+    case EBPAnalyzerStage::TokenCount:           return TEXT("TokenCount");
+    case EBPAnalyzerStage::WidgetAnalysis:       return TEXT("WidgetAnalysis");
+    case EBPAnalyzerStage::ExportJSON:           return TEXT("ExportJSON");
+    case EBPAnalyzerStage::ExportLLMText:        return TEXT("ExportLLMText");
+    case EBPAnalyzerStage::CycleDetection:       return TEXT("CycleDetection");
+    case EBPAnalyzerStage::ExportBinary:         return TEXT("ExportBinary");
+    case EBPAnalyzerStage::ExportIndex:          return TEXT("ExportIndex");
+    default:                                     return TEXT("Unknown");
+    }
+}
+
+// ============================================================
+// FBPStageProfiler::FRun
+// ============================================================
+
+FBPStageProfiler::FRun::FRun()
+{
+    for (int32 Stage = 0; Stage < NumStages; ++Stage)
+    {
+        BeginCycles[Stage] = StageCycles[Stage].load(std::memory_order_relaxed);
+        BeginCalls[Stage] = StageCalls[Stage].load(std::memory_order_relaxed);
+    }
+
+    FScopeLock Lock(&OpenRunsLock);
+    OpenRuns.Add(this);
+}
+
+FBPStageProfiler::FRun::~FRun()
+{
+    FScopeLock Lock(&OpenRunsLock);
+    OpenRuns.RemoveSingleSwap(this);
+}
+
+TArray<FBPStageTiming> FBPStageProfiler::FRun::GetTimings() const
+{
+    FScopeLock Lock(&OpenRunsLock);
+
+    TArray<FBPStageTiming> Timings;
+    for (int32 Stage = 0; Stage < NumStages; ++Stage)
+    {
+        const uint32 Calls = StageCalls[Stage].load(std::memory_order_relaxed) - BeginCalls[Stage];
+        if (Calls == 0) continue;
+
+        FBPStageTiming& Timing = Timings.AddDefaulted_GetRef();
+        Timing.Stage = GetStageName((EBPAnalyzerStage)Stage);
+        Timing.Calls = (int32)Calls;
+        Timing.WallSeconds = (float)FPlatformTime::ToSeconds64(StageCycles[Stage].load(std::memory_order_relaxed) - BeginCycles[Stage]);
+        Timing.PeakUsedPhysicalBytes = (int64)PeakUsedPhysical[Stage];
+    }
+    return Timings;
+}
+
+// ============================================================
+// FBPStageScope
+// ============================================================
+
+FBPStageScope::FBPStageScope(EBPAnalyzerStage InStage)
+    : Stage(InStage)
+{
+    if (!FBPStageProfiler::IsEnabled()) return;
+
+    bActive = true;
+    StartCycles = FPlatformTime::Cycles64();
+
+    Parent = CurrentStageScope;
+    if (Parent && Parent->bActive)
+    {
+        Parent->ElapsedCycles += StartCycles - Parent->StartCycles;
+    }
+    CurrentStageScope = this;
+}
+
+FBPStageScope::~FBPStageScope()
+{
+    if (!bActive) return;
+
+    const uint64 EndCycles = FPlatformTime::Cycles64();
+    ElapsedCycles += EndCycles - StartCycles;
+
+    // A stage re-entered from inside itself is one call, not two
+    const bool bReentered = Parent && Parent->bActive && Parent->Stage == Stage;
+    FBPStageProfiler::Add(Stage, ElapsedCycles, bReentered ? 0 : 1);
+    FBPStageProfiler::SampleMemory(Stage);
+
+    CurrentStageScope = Parent;
+    if (Parent && Parent->bActive)
+    {
+        Parent->StartCycles = EndCycles;
+    }
+}
@@ -0,0 +1,174 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerRegistryScan.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Animation/AnimInstance.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "WidgetBlueprint.h"
+#include "Misc/PackageName.h"
+#include "Misc/DateTime.h"
+
+// "/Script/CoreUObject.Class'/Script/Engine.Actor'" or "/Game/BP_Base.BP_Base_C" -> "Actor" / "BP_Base_C"
+static FString ShortClassNameFromTag(const FString& TagValue)
+{
+    FString ObjectPath = FPackageName::ExportTextPathToObjectPath(TagValue);
+    ObjectPath.TrimQuotesInline();
+
+    int32 DotIndex = INDEX_NONE;
+    return ObjectPath.FindLastChar(TEXT('.'), DotIndex) ? ObjectPath.Mid(DotIndex + 1) : ObjectPath;
+}
+
+// ImplementedInterfaces tag is an exported TArray<FBPInterfaceDescription>:
+// ((Interface="/Script/CoreUObject.Class'/Script/Mod.Foo'",Graphs=(...)),(...))
+static TArray<FString> ParseInterfacesTag(const FString& TagValue)
+{
+    static const FString InterfaceKey = TEXT("Interface=");
+
+    TArray<FString> Out;
+    int32 SearchFrom = 0;
+    while (true)
+    {
+        const int32 KeyIndex = TagValue.Find(InterfaceKey, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchFrom);
+        if (KeyIndex == INDEX_NONE) break;
+
+        const int32 ValueStart = KeyIndex + InterfaceKey.Len();
+        int32 ValueEnd = ValueStart;
+        bool bInQuotes = false;
+        while (ValueEnd < TagValue.Len())
+        {
+            const TCHAR Ch = TagValue[ValueEnd];
+            if (Ch == TEXT('"')) bInQuotes = !bInQuotes;
+            else if (!bInQuotes && (Ch == TEXT(',') || Ch == TEXT(')'))) break;
+            ++ValueEnd;
+        }
+
+        const FString Name = ShortClassNameFromTag(TagValue.Mid(ValueStart, ValueEnd - ValueStart));
+        if (!Name.IsEmpty() && Name != TEXT("None"))
+        {
+            Out.Add(Name);
+        }
+        SearchFrom = ValueEnd;
+    }
+    return Out;
+}
+
+// Mirrors UBlueprintAnalyzerLibrary::GetBlueprintTypeString, using the native parent
+// class (always resident) instead of the unloaded generated class.
+FString FBPRegistryScan::GetBlueprintTypeFromTags(const FAssetData& AssetData)
+{
+    if (UClass* AssetClass = AssetData.GetClass())
+    {
+        if (AssetClass->IsChildOf<UWidgetBlueprint>()) return TEXT("WidgetBlueprint");
+    }
+
+    FString NativeParentPath;
+    if (AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentPath))
+    {
+        const FString ObjectPath = FPackageName::ExportTextPathToObjectPath(NativeParentPath);
+        if (UClass* NativeParent = FindObject<UClass>(nullptr, *ObjectPath))
+        {
+            if (NativeParent->IsChildOf<UAnimInstance>()) return TEXT("AnimBlueprint");
+            if (NativeParent->IsChildOf<AActor>()) return TEXT("ActorBlueprint");
+            if (NativeParent->IsChildOf<UActorComponent>()) return TEXT("ComponentBlueprint");
+        }
+    }
+
+    FString BlueprintTypeTag;
+    AssetData.GetTagValue(FBlueprintTags::BlueprintType, BlueprintTypeTag);
+
+    if (BlueprintTypeTag == TEXT("BPTYPE_Interface")) return TEXT("InterfaceBlueprint");
+    if (BlueprintTypeTag == TEXT("BPTYPE_Const")) return TEXT("ConstBlueprint");
+    if (BlueprintTypeTag == TEXT("BPTYPE_MacroLibrary")) return TEXT("MacroLibrary");
+    if (BlueprintTypeTag == TEXT("BPTYPE_LevelScript")) return TEXT("LevelScript");
+    if (BlueprintTypeTag == TEXT("BPTYPE_FunctionLibrary")) return TEXT("FunctionLibrary");
+    return TEXT("Blueprint");
+}
+
+FBPBlueprintSummary FBPRegistryScan::SummarizeAsset(const FAssetData& AssetData)
+{
+    FBPBlueprintSummary Summary;
+    Summary.bQuickScan = true;
+    Summary.BlueprintName = AssetData.AssetName.ToString();
+    Summary.BlueprintPath = AssetData.GetObjectPathString();
+    Summary.BlueprintType = GetBlueprintTypeFromTags(AssetData);
+
+    FString TagValue;
+    if (AssetData.GetTagValue(FBlueprintTags::ParentClassPath, TagValue))
+    {
+        Summary.ParentClass = ShortClassNameFromTag(TagValue);
+    }
+    if (AssetData.GetTagValue(FBlueprintTags::ImplementedInterfaces, TagValue))
+    {
+        Summary.ImplementedInterfaces = ParseInterfacesTag(TagValue);
+    }
+
+    FillPackageInfo(AssetData, Summary);
+    return Summary;
+}
+
+void FBPRegistryScan::FillPackageInfo(const FAssetData& AssetData, FBPBlueprintSummary& Summary)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    if (TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(AssetData.PackageName))
+    {
+        Summary.PackageDiskSize = PackageData->DiskSize;
+    }
+
+    TArray<FName> Packages;
+    AssetRegistry.GetDependencies(AssetData.PackageName, Packages, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+    Summary.HardDependencyCount = Packages.Num();
+
+    Packages.Reset();
+    AssetRegistry.GetDependencies(AssetData.PackageName, Packages, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Soft);
+    Summary.SoftDependencyCount = Packages.Num();
+
+    Packages.Reset();
+    AssetRegistry.GetReferencers(AssetData.PackageName, Packages, UE::AssetRegistry::EDependencyCategory::Package);
+    Summary.ReferencerCount = Packages.Num();
+}
+
+FBPProjectAnalysis FBPRegistryScan::ScanFolder(const FString& FolderPath, const TArray<FAssetData>& Assets)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    FBPProjectAnalysis Result;
+    Result.FolderPath = FolderPath;
+    Result.AnalysisTimestamp = FDateTime::Now().ToString();
+    Result.bQuickScan = true;
+
+    // Package -> asset name, so package edges between scanned Blueprints can feed cycle detection
+    TMap<FName, FString> ScannedPackages;
+    ScannedPackages.Reserve(Assets.Num());
+    for (const FAssetData& AssetData : Assets)
+    {
+        ScannedPackages.Add(AssetData.PackageName, AssetData.AssetName.ToString());
+    }
+
+    TArray<FName> Dependencies;
+    for (const FAssetData& AssetData : Assets)
+    {
+        FBPBlueprintSummary& Summary = Result.Summaries.Add_GetRef(SummarizeAsset(AssetData));
+        Result.BlueprintsAnalyzed++;
+
+        Dependencies.Reset();
+        AssetRegistry.GetDependencies(AssetData.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+        for (const FName& DependencyPackage : Dependencies)
+        {
+            const FString* ReferencedName = ScannedPackages.Find(DependencyPackage);
+            if (!ReferencedName || DependencyPackage == AssetData.PackageName) continue;
+
+            FBPDependency& Dep = Result.Dependencies.AddDefaulted_GetRef();
+            Dep.ReferencingBlueprint = Summary.BlueprintName;
+            Dep.ReferencedClass = *ReferencedName;
+            Dep.ReferenceType = TEXT("Package");
+        }
+    }
+
+    UBlueprintAnalyzerLibrary::FindCircularDependencies(Result);
+
+    return Result;
+}
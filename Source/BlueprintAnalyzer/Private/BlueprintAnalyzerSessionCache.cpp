@@ -0,0 +1,370 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerSessionCache.h"
+#include "BlueprintAnalyzerMacroCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+static bool bIncrementalEnabled = true;
+static FAutoConsoleVariableRef CVarIncremental(
+    TEXT("BlueprintAnalyzer.Incremental"),
+    bIncrementalEnabled,
+    TEXT("Patch cached Blueprint analyses per edited graph after each compile instead of re-analyzing the whole Blueprint."));
+
+UBlueprintAnalyzerSessionCache* UBlueprintAnalyzerSessionCache::Get()
+{
+    return GEditor ? GEditor->GetEditorSubsystem<UBlueprintAnalyzerSessionCache>() : nullptr;
+}
+
+void UBlueprintAnalyzerSessionCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddUObject(this, &UBlueprintAnalyzerSessionCache::HandleObjectModified);
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddUObject(this, &UBlueprintAnalyzerSessionCache::HandlePackageSaved);
+    if (GEditor)
+    {
+        PreCompileHandle = GEditor->OnBlueprintPreCompile().AddUObject(this, &UBlueprintAnalyzerSessionCache::HandleBlueprintPreCompile);
+        CompiledHandle = GEditor->OnBlueprintCompiled().AddUObject(this, &UBlueprintAnalyzerSessionCache::HandleBlueprintCompiled);
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddUObject(this, &UBlueprintAnalyzerSessionCache::HandleAssetChanged);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddUObject(this, &UBlueprintAnalyzerSessionCache::HandleAssetChanged);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddUObject(this, &UBlueprintAnalyzerSessionCache::HandleAssetRenamed);
+}
+
+void UBlueprintAnalyzerSessionCache::Deinitialize()
+{
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(PreCompileHandle);
+        GEditor->OnBlueprintCompiled().Remove(CompiledHandle);
+    }
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    ClearSessionCache();
+    Super::Deinitialize();
+}
+
+UBlueprintAnalyzerSessionCache::FAssetEntry* UBlueprintAnalyzerSessionCache::FindOrAddEntry(UBlueprint* Blueprint)
+{
+    UPackage* Package = Blueprint ? Blueprint->GetOutermost() : nullptr;
+    if (!Package || Package == GetTransientPackage()) return nullptr;
+
+    return &AssetEntries.FindOrAdd(Package->GetFName());
+}
+
+int32 UBlueprintAnalyzerSessionCache::RefreshIncremental(UBlueprint* Blueprint, FAssetEntry& Entry)
+{
+    int32 NumExtracted = 0;
+    if (!Entry.Incremental.IsSet())
+    {
+        Entry.Incremental.Emplace();
+        Entry.Incremental->Build(Blueprint);
+        NumExtracted = Entry.Incremental->GetNumGraphs();
+    }
+    else if (Entry.bIncrementalStale || Entry.Incremental->GetTraceLimits() != FBPTraceLimits::FromConsoleVariables())
+    {
+        NumExtracted = Entry.Incremental->Update(Blueprint, Entry.DirtyGraphs);
+    }
+    else
+    {
+        return 0;
+    }
+
+    Entry.DirtyGraphs.Reset();
+    Entry.bIncrementalStale = false;
+
+    // Graphs may have been added or removed since the last watch
+    WatchGraphs(Blueprint, Entry);
+    return NumExtracted;
+}
+
+// Graph-changed notifications cover node additions and removals made outside a transaction
+void UBlueprintAnalyzerSessionCache::WatchGraphs(UBlueprint* Blueprint, FAssetEntry& Entry)
+{
+    UnwatchGraphs(Entry);
+
+    TArray<TPair<UEdGraph*, EBPGraphKind>> Graphs;
+    FBPIncrementalAnalysis::GatherGraphs(Blueprint, Graphs);
+    for (const TPair<UEdGraph*, EBPGraphKind>& Graph : Graphs)
+    {
+        const FDelegateHandle Handle = Graph.Key->AddOnGraphChangedHandler(
+            FOnGraphChanged::FDelegate::CreateUObject(this, &UBlueprintAnalyzerSessionCache::HandleGraphChanged));
+        Entry.GraphWatches.Emplace(Graph.Key, Handle);
+    }
+}
+
+void UBlueprintAnalyzerSessionCache::UnwatchGraphs(FAssetEntry& Entry)
+{
+    for (const TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>& Watch : Entry.GraphWatches)
+    {
+        if (UEdGraph* Graph = Watch.Key.Get())
+        {
+            Graph->RemoveOnGraphChangedHandler(Watch.Value);
+        }
+    }
+    Entry.GraphWatches.Reset();
+}
+
+FBlueprintAnalysisResult UBlueprintAnalyzerSessionCache::GetBlueprintAnalysis(UBlueprint* Blueprint)
+{
+    FAssetEntry* Entry = FindOrAddEntry(Blueprint);
+    if (!Entry) return UBlueprintAnalyzerLibrary::AnalyzeBlueprint(Blueprint);
+
+    if (bIncrementalEnabled)
+    {
+        RefreshIncremental(Blueprint, *Entry);
+        return Entry->Incremental->GetAnalysis();
+    }
+
+    // Execution paths follow the BlueprintAnalyzer.Trace* limits, which may have changed since
+    const FBPTraceLimits TraceLimits = FBPTraceLimits::FromConsoleVariables();
+    if (!Entry->Analysis.IsSet() || Entry->AnalysisTraceLimits != TraceLimits)
+    {
+        Entry->Analysis = UBlueprintAnalyzerLibrary::AnalyzeBlueprint(Blueprint);
+        Entry->AnalysisTraceLimits = TraceLimits;
+    }
+    return Entry->Analysis.GetValue();
+}
+
+FBPPerformanceReport UBlueprintAnalyzerSessionCache::GetPerformanceReport(UBlueprint* Blueprint)
+{
+    FAssetEntry* Entry = FindOrAddEntry(Blueprint);
+    if (!Entry) return UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(Blueprint);
+
+    // The perf report comes out of the same per-graph extraction as the full analysis
+    if (bIncrementalEnabled)
+    {
+        RefreshIncremental(Blueprint, *Entry);
+        return Entry->Incremental->GetPerformanceReport();
+    }
+
+    if (!Entry->PerformanceReport.IsSet())
+    {
+        Entry->PerformanceReport = UBlueprintAnalyzerLibrary::AnalyzeBlueprintPerformance(Blueprint);
+    }
+    return Entry->PerformanceReport.GetValue();
+}
+
+FWidgetOptimizationReport UBlueprintAnalyzerSessionCache::GetWidgetReport(UBlueprint* Blueprint)
+{
+    FAssetEntry* Entry = FindOrAddEntry(Blueprint);
+    if (!Entry) return UBlueprintAnalyzerLibrary::AnalyzeWidgetBlueprint(Blueprint);
+
+    if (!Entry->WidgetReport.IsSet())
+    {
+        Entry->WidgetReport = UBlueprintAnalyzerLibrary::AnalyzeWidgetBlueprint(Blueprint);
+    }
+    return Entry->WidgetReport.GetValue();
+}
+
+const FBPProjectAnalysis* UBlueprintAnalyzerSessionCache::FindFolderAnalysis(const FString& FolderPath) const
+{
+    return FolderEntries.Find(FolderPath);
+}
+
+uint64 UBlueprintAnalyzerSessionCache::BeginFolderAnalysis(const FString& FolderPath)
+{
+    FolderChangeSerials.FindOrAdd(FolderPath, 0);
+    return ++ChangeSerial;
+}
+
+void UBlueprintAnalyzerSessionCache::StoreFolderAnalysis(const FBPProjectAnalysis& Analysis, uint64 Token)
+{
+    // Tracked from here on either way, so InvalidateFolders finds the entry
+    if (FolderChangeSerials.FindOrAdd(Analysis.FolderPath, 0) > Token) return;
+
+    FolderEntries.Add(Analysis.FolderPath, Analysis);
+}
+
+void UBlueprintAnalyzerSessionCache::InvalidatePackage(FName PackageName)
+{
+    if (AssetEntries.Num() > 0)
+    {
+        if (FAssetEntry* Entry = AssetEntries.Find(PackageName))
+        {
+            UnwatchGraphs(*Entry);
+            AssetEntries.Remove(PackageName);
+        }
+    }
+
+    InvalidateFolders(PackageName);
+}
+
+void UBlueprintAnalyzerSessionCache::MarkPackageEdited(FName PackageName, const UObject* EditedObject)
+{
+    FAssetEntry* Entry = AssetEntries.Find(PackageName);
+    if (!Entry || !Entry->Incremental.IsSet())
+    {
+        InvalidatePackage(PackageName);
+        return;
+    }
+
+    Entry->Analysis.Reset();
+    Entry->PerformanceReport.Reset();
+    Entry->WidgetReport.Reset();
+    Entry->bIncrementalStale = true;
+
+    // Nodes live directly in their graph; edits to the Blueprint itself only refresh metadata
+    const UEdGraph* Graph = Cast<UEdGraph>(EditedObject);
+    if (!Graph && EditedObject)
+    {
+        Graph = EditedObject->GetTypedOuter<UEdGraph>();
+    }
+    if (Graph)
+    {
+        Entry->DirtyGraphs.Add(Graph);
+    }
+
+    InvalidateFolders(PackageName);
+}
+
+void UBlueprintAnalyzerSessionCache::InvalidateMacroDependents(FName MacroPackageName)
+{
+    // Which Blueprints instance the library's macros is not recorded, so every other entry goes;
+    // the library's own entry is patched like any other edit
+    for (auto It = AssetEntries.CreateIterator(); It; ++It)
+    {
+        if (It.Key() != MacroPackageName)
+        {
+            UnwatchGraphs(It.Value());
+            It.RemoveCurrent();
+        }
+    }
+    FolderEntries.Reset();
+
+    // Runs in progress may have read the macros before the compile
+    ++ChangeSerial;
+    for (TPair<FString, uint64>& Pair : FolderChangeSerials)
+    {
+        Pair.Value = ChangeSerial;
+    }
+}
+
+void UBlueprintAnalyzerSessionCache::InvalidateFolders(FName PackageName)
+{
+    if (FolderChangeSerials.Num() > 0)
+    {
+        // Folder analysis is recursive, so any ancestor folder result is stale too
+        const FString PackagePath = PackageName.ToString();
+        ++ChangeSerial;
+        for (TPair<FString, uint64>& Pair : FolderChangeSerials)
+        {
+            if (PackagePath.StartsWith(Pair.Key + TEXT("/")))
+            {
+                Pair.Value = ChangeSerial;
+                FolderEntries.Remove(Pair.Key);
+            }
+        }
+    }
+}
+
+void UBlueprintAnalyzerSessionCache::ClearSessionCache()
+{
+    for (TPair<FName, FAssetEntry>& Pair : AssetEntries)
+    {
+        UnwatchGraphs(Pair.Value);
+    }
+    AssetEntries.Reset();
+    PendingCompiles.Reset();
+    FolderEntries.Reset();
+}
+
+void UBlueprintAnalyzerSessionCache::HandleObjectModified(UObject* Object)
+{
+    // Fires for every transacted edit in the editor; stay cheap when nothing is cached
+    if (!Object || (AssetEntries.Num() == 0 && FolderChangeSerials.Num() == 0)) return;
+
+    MarkPackageEdited(Object->GetOutermost()->GetFName(), Object);
+}
+
+void UBlueprintAnalyzerSessionCache::HandleGraphChanged(const FEdGraphEditAction& Action)
+{
+    if (Action.Graph)
+    {
+        MarkPackageEdited(Action.Graph->GetOutermost()->GetFName(), Action.Graph);
+    }
+}
+
+void UBlueprintAnalyzerSessionCache::HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    if (Package)
+    {
+        MarkPackageEdited(Package->GetFName(), nullptr);
+    }
+}
+
+void UBlueprintAnalyzerSessionCache::HandleBlueprintPreCompile(UBlueprint* Blueprint)
+{
+    if (!Blueprint) return;
+
+    // Macro edits only take effect through a compile
+    FBPMacroCache::Get().InvalidateBlueprint(Blueprint);
+
+    const FName PackageName = Blueprint->GetOutermost()->GetFName();
+    if (Blueprint->MacroGraphs.Num() > 0)
+    {
+        InvalidateMacroDependents(PackageName);
+    }
+    MarkPackageEdited(PackageName, nullptr);
+
+    const FAssetEntry* Entry = AssetEntries.Find(PackageName);
+    if (Entry && Entry->Incremental.IsSet())
+    {
+        PendingCompiles.AddUnique(Blueprint);
+    }
+}
+
+void UBlueprintAnalyzerSessionCache::HandleBlueprintCompiled()
+{
+    // Listeners may compile again, which queues into a fresh list
+    const TArray<TWeakObjectPtr<UBlueprint>> Compiled = MoveTemp(PendingCompiles);
+    PendingCompiles.Reset();
+
+    for (const TWeakObjectPtr<UBlueprint>& WeakBlueprint : Compiled)
+    {
+        UBlueprint* Blueprint = WeakBlueprint.Get();
+        FAssetEntry* Entry = Blueprint ? AssetEntries.Find(Blueprint->GetOutermost()->GetFName()) : nullptr;
+        if (!Entry || !Entry->Incremental.IsSet()) continue;
+
+        const double StartTime = FPlatformTime::Seconds();
+        const int32 NumExtracted = RefreshIncremental(Blueprint, *Entry);
+        const FBPPerformanceReport Report = Entry->Incremental->GetPerformanceReport();
+
+        UE_LOG(LogTemp, Log, TEXT("BlueprintAnalyzer: %s re-analyzed after compile (%d of %d graphs, %.1f ms), performance score %d"),
+            *Blueprint->GetName(), NumExtracted, Entry->Incremental->GetNumGraphs(),
+            (FPlatformTime::Seconds() - StartTime) * 1000.0, Report.PerformanceScore);
+
+        BlueprintReanalyzedEvent.Broadcast(Blueprint, Report);
+    }
+}
+
+void UBlueprintAnalyzerSessionCache::HandleAssetChanged(const FAssetData& AssetData)
+{
+    InvalidatePackage(AssetData.PackageName);
+}
+
+void UBlueprintAnalyzerSessionCache::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    InvalidatePackage(AssetData.PackageName);
+    InvalidatePackage(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+}
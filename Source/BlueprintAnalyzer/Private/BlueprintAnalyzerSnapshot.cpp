@@ -0,0 +1,2027 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerSnapshot.h"
+#include "BlueprintAnalyzerCommentIndex.h"
+#include "BlueprintAnalyzerCostModel.h"
+#include "BlueprintAnalyzerGraphAlgo.h"
+#include "BlueprintAnalyzerMacroCache.h"
+#include "K2Node.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Composite.h"
+#include "K2Node_Tunnel.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_SpawnActorFromClass.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/Reverse.h"
+#include "Misc/DateTime.h"
+
+// ============================================================
+// Capture (game thread)
+// ============================================================
+
+// Helper: identify Tick / BeginPlay entry points
+static bool IsTickEvent(UK2Node* Node)
+{
+    if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+    {
+        const FString Name = EventNode->EventReference.GetMemberName().ToString();
+        return Name.Equals(TEXT("ReceiveTick"), ESearchCase::IgnoreCase) ||
+               Name.Equals(TEXT("Tick"), ESearchCase::IgnoreCase);
+    }
+    return false;
+}
+
+static bool IsBeginPlayEvent(UK2Node* Node)
+{
+    if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+    {
+        const FString Name = EventNode->EventReference.GetMemberName().ToString();
+        return Name.Equals(TEXT("ReceiveBeginPlay"), ESearchCase::IgnoreCase) ||
+               Name.Equals(TEXT("BeginPlay"), ESearchCase::IgnoreCase);
+    }
+    return false;
+}
+
+// SetTimerByEvent / SetTimerByFunctionName; the ForNextTick variants fire once
+static bool IsTimerSetter(const FBPNodeSnapshot& Node)
+{
+    return Node.bIsCallFunction && Node.CallFunctionName.StartsWith(TEXT("K2_SetTimer")) && !Node.CallFunctionName.Contains(TEXT("ForNextTick"));
+}
+
+FBPBlueprintSnapshot FBPSnapshotAnalyzer::Capture(UBlueprint* Blueprint)
+{
+    check(IsInGameThread());
+    BPA_STAGE_SCOPE(GraphCapture);
+
+    FBPBlueprintSnapshot Snapshot;
+    if (!Blueprint) return Snapshot;
+
+    Snapshot.BlueprintName = Blueprint->GetName();
+    Snapshot.BlueprintPath = Blueprint->GetPathName();
+    Snapshot.BlueprintType = UBlueprintAnalyzerLibrary::GetBlueprintTypeString(Blueprint);
+    Snapshot.Metadata = UBlueprintAnalyzerLibrary::ExtractMetadata(Blueprint);
+
+    // Same order as AnalyzeBlueprint has always listed nodes in
+    CaptureGraphs(Blueprint->UbergraphPages, EBPGraphKind::Ubergraph, Snapshot);
+    CaptureGraphs(Blueprint->FunctionGraphs, EBPGraphKind::Function, Snapshot);
+    CaptureGraphs(Blueprint->MacroGraphs, EBPGraphKind::Macro, Snapshot);
+    CaptureGraphs(Blueprint->DelegateSignatureGraphs, EBPGraphKind::DelegateSignature, Snapshot);
+    CaptureGraphs(Blueprint->IntermediateGeneratedGraphs, EBPGraphKind::Intermediate, Snapshot);
+
+    TArray<UEdGraph*> CollapsedGraphs;
+    GatherCollapsedGraphs(Blueprint->UbergraphPages, CollapsedGraphs);
+    GatherCollapsedGraphs(Blueprint->FunctionGraphs, CollapsedGraphs);
+    CaptureGraphs(CollapsedGraphs, EBPGraphKind::Collapsed, Snapshot);
+
+    BuildAdjacency(Snapshot);
+    ResolveCallees(Snapshot);
+
+    return Snapshot;
+}
+
+FBPBlueprintSnapshot FBPSnapshotAnalyzer::CaptureGraph(UBlueprint* Blueprint, UEdGraph* Graph, EBPGraphKind Kind)
+{
+    check(IsInGameThread());
+    BPA_STAGE_SCOPE(GraphCapture);
+
+    FBPBlueprintSnapshot Snapshot;
+    if (!Blueprint || !Graph) return Snapshot;
+
+    Snapshot.BlueprintName = Blueprint->GetName();
+    Snapshot.BlueprintPath = Blueprint->GetPathName();
+    Snapshot.BlueprintType = UBlueprintAnalyzerLibrary::GetBlueprintTypeString(Blueprint);
+
+    CaptureGraphs({ Graph }, Kind, Snapshot);
+    BuildAdjacency(Snapshot);
+    ResolveCallees(Snapshot);
+
+    return Snapshot;
+}
+
+FBPBlueprintSnapshot FBPSnapshotAnalyzer::CaptureGraphInContext(UBlueprint* Blueprint, UEdGraph* Graph, EBPGraphKind Kind,
+    const TArray<TPair<UEdGraph*, EBPGraphKind>>& Graphs, TArray<UEdGraph*>& OutContextGraphs)
+{
+    check(IsInGameThread());
+    BPA_STAGE_SCOPE(GraphCapture);
+
+    OutContextGraphs.Reset();
+
+    FBPBlueprintSnapshot Snapshot;
+    if (!Blueprint || !Graph) return Snapshot;
+
+    Snapshot.BlueprintName = Blueprint->GetName();
+    Snapshot.BlueprintPath = Blueprint->GetPathName();
+    Snapshot.BlueprintType = UBlueprintAnalyzerLibrary::GetBlueprintTypeString(Blueprint);
+
+    CaptureGraphs({ Graph }, Kind, Snapshot);
+
+    // Callees are looked up as ResolveCallees does, by kind and name
+    TMap<TPair<EBPGraphKind, FString>, UEdGraph*> Callees;
+    for (const TPair<UEdGraph*, EBPGraphKind>& Candidate : Graphs)
+    {
+        if (Candidate.Key != Graph && (Candidate.Value == EBPGraphKind::Function || Candidate.Value == EBPGraphKind::Collapsed))
+        {
+            Callees.Add({ Candidate.Value, Candidate.Key->GetName() }, Candidate.Key);
+        }
+    }
+
+    // Breadth-first over the graphs captured so far, each adding the callees not yet captured
+    TArray<TPair<UEdGraph*, EBPGraphKind>> Wanted;
+    for (int32 GraphIndex = 0; GraphIndex < Snapshot.Graphs.Num(); ++GraphIndex)
+    {
+        Wanted.Reset();
+        bool bWantsAll = false;
+
+        const FBPGraphSnapshot& Captured = Snapshot.Graphs[GraphIndex];
+        for (int32 NodeIndex = Captured.FirstNode; NodeIndex < Captured.FirstNode + Captured.NumNodes; ++NodeIndex)
+        {
+            const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+
+            // A timer naming its target can run any event or function (see CollectTimerTargets)
+            if (GraphIndex == 0 && Kind == EBPGraphKind::Ubergraph && IsTimerSetter(Node))
+            {
+                for (const FBPPinSnapshot& Pin : Snapshot.GetPins(Node))
+                {
+                    bWantsAll |= Pin.PinName == TEXT("FunctionName") && !Pin.Literal.IsEmpty();
+                }
+            }
+
+            if (Node.CalleeGraphName.IsEmpty()) continue;
+
+            UEdGraph* const* Callee = Callees.Find({ Node.CalleeGraphKind, Node.CalleeGraphName });
+            if (Callee && !OutContextGraphs.Contains(*Callee))
+            {
+                Wanted.AddUnique({ *Callee, Node.CalleeGraphKind });
+            }
+        }
+
+        if (bWantsAll)
+        {
+            for (const TPair<UEdGraph*, EBPGraphKind>& Candidate : Graphs)
+            {
+                if (Candidate.Key != Graph && !OutContextGraphs.Contains(Candidate.Key))
+                {
+                    OutContextGraphs.Add(Candidate.Key);
+                    CaptureGraphs({ Candidate.Key }, Candidate.Value, Snapshot);
+                }
+            }
+            break;
+        }
+
+        for (const TPair<UEdGraph*, EBPGraphKind>& Callee : Wanted)
+        {
+            OutContextGraphs.Add(Callee.Key);
+            CaptureGraphs({ Callee.Key }, Callee.Value, Snapshot);
+        }
+    }
+
+    for (int32 GraphIndex = 1; GraphIndex < Snapshot.Graphs.Num(); ++GraphIndex)
+    {
+        Snapshot.Graphs[GraphIndex].bIsContext = true;
+    }
+
+    BuildAdjacency(Snapshot);
+    ResolveCallees(Snapshot);
+
+    return Snapshot;
+}
+
+void FBPSnapshotAnalyzer::GatherCollapsedGraphs(const TArray<UEdGraph*>& Graphs, TArray<UEdGraph*>& OutCollapsedGraphs)
+{
+    // Breadth-first, so graphs nested deeper follow every graph of the level above
+    const int32 FirstCollapsed = OutCollapsedGraphs.Num();
+    auto GatherFrom = [&OutCollapsedGraphs](const UEdGraph* Graph)
+    {
+        for (const UEdGraphNode* GraphNode : Graph->Nodes)
+        {
+            const UK2Node_Composite* CompositeNode = Cast<UK2Node_Composite>(GraphNode);
+            if (CompositeNode && CompositeNode->BoundGraph)
+            {
+                OutCollapsedGraphs.Add(CompositeNode->BoundGraph);
+            }
+        }
+    };
+
+    for (const UEdGraph* Graph : Graphs)
+    {
+        if (Graph)
+        {
+            GatherFrom(Graph);
+        }
+    }
+    for (int32 Index = FirstCollapsed; Index < OutCollapsedGraphs.Num(); ++Index)
+    {
+        GatherFrom(OutCollapsedGraphs[Index]);
+    }
+}
+
+void FBPSnapshotAnalyzer::CaptureGraphs(const TArray<UEdGraph*>& Graphs, EBPGraphKind Kind, FBPBlueprintSnapshot& Snapshot)
+{
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph) continue;
+
+        const int32 GraphIndex = Snapshot.Graphs.AddDefaulted();
+        {
+            FBPGraphSnapshot& GraphSnapshot = Snapshot.Graphs[GraphIndex];
+            GraphSnapshot.GraphName = Graph->GetName();
+            GraphSnapshot.Kind = Kind;
+            GraphSnapshot.TotalNodeCount = Graph->Nodes.Num();
+            GraphSnapshot.FirstNode = Snapshot.Nodes.Num();
+        }
+
+        // First pass: assign dense node and pin indices so links can be stored without pointers
+        TArray<UK2Node*> K2Nodes;
+        TArray<int32> PinOwners;
+        TMap<const UEdGraphPin*, int32> PinIndices;
+        const int32 FirstPin = Snapshot.Pins.Num();
+        for (UEdGraphNode* GraphNode : Graph->Nodes)
+        {
+            if (UK2Node* K2Node = Cast<UK2Node>(GraphNode))
+            {
+                const int32 NodeIndex = Snapshot.Nodes.Num() + K2Nodes.Num();
+                K2Nodes.Add(K2Node);
+                for (const UEdGraphPin* Pin : K2Node->Pins)
+                {
+                    PinIndices.Add(Pin, FirstPin + PinOwners.Num());
+                    PinOwners.Add(NodeIndex);
+                }
+            }
+        }
+        const int32 NumPins = PinOwners.Num();
+        const FBPCommentIndex CommentIndex = FBPCommentIndex::ForGraph(Graph);
+        Snapshot.Graphs[GraphIndex].NumNodes = K2Nodes.Num();
+        Snapshot.Nodes.Reserve(Snapshot.Nodes.Num() + K2Nodes.Num());
+        Snapshot.Pins.Reserve(Snapshot.Pins.Num() + NumPins);
+        Snapshot.PinLinkOffsets.Reserve(Snapshot.Pins.Num() + NumPins + 1);
+
+        for (UK2Node* K2Node : K2Nodes)
+        {
+            const int32 NodeIndex = Snapshot.Nodes.Num();
+            FBPNodeSnapshot& Node = Snapshot.Nodes.AddDefaulted_GetRef();
+            Node.NodeGuid = K2Node->NodeGuid;
+            Node.GraphIndex = GraphIndex;
+            Node.NodeType = UBlueprintAnalyzerLibrary::GetNodeTypeName(K2Node);
+            Node.Title = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+            Node.CommentGroup = CommentIndex.FindCommentGroup(K2Node);
+            Node.FirstPin = Snapshot.Pins.Num();
+            Node.NumPins = K2Node->Pins.Num();
+
+            Node.bIsEvent = K2Node->IsA<UK2Node_Event>();
+            Node.bIsFunctionEntry = K2Node->IsA<UK2Node_FunctionEntry>();
+            Node.bIsTickEvent = IsTickEvent(K2Node);
+            Node.bIsBeginPlayEvent = IsBeginPlayEvent(K2Node);
+            Node.bIsSpawnActor = K2Node->IsA<UK2Node_SpawnActorFromClass>();
+            Node.bIsSequence = K2Node->IsA<UK2Node_ExecutionSequence>();
+
+            // Collapsed and macro instance nodes are tunnels too; only the graph-side tunnels count
+            const UK2Node_Tunnel* TunnelNode = Cast<UK2Node_Tunnel>(K2Node);
+            if (TunnelNode && !K2Node->IsA<UK2Node_Composite>() && !K2Node->IsA<UK2Node_MacroInstance>())
+            {
+                Node.bIsTunnelEntry = TunnelNode->bCanHaveOutputs && !TunnelNode->bCanHaveInputs;
+                Node.bIsTunnelExit = TunnelNode->bCanHaveInputs && !TunnelNode->bCanHaveOutputs;
+            }
+
+            if (Node.bIsFunctionEntry || Node.bIsTunnelEntry)
+            {
+                Snapshot.Graphs[GraphIndex].EntryNode = NodeIndex;
+            }
+
+            if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(K2Node))
+            {
+                Node.bIsCallFunction = true;
+                if (UFunction* Fn = CallNode->GetTargetFunction())
+                {
+                    Node.CallFunctionName = Fn->GetName();
+                    Node.FunctionName = Node.CallFunctionName;
+                    Node.StepSummary = FString::Printf(TEXT("%s(...)"), *Node.CallFunctionName);
+
+                    // Latent node detection: CallFunction flagged with MD_Latent metadata
+                    Node.bIsLatent = Fn->HasMetaData(FBlueprintMetadata::MD_Latent);
+
+                    if (UClass* OwnerClass = Fn->GetOuterUClass())
+                    {
+                        Node.CallOwnerClass = OwnerClass->GetName();
+
+                        // Calls into this Blueprint's own functions can be expanded by the tracer
+                        if (UBlueprint::GetBlueprintFromClass(OwnerClass) == K2Node->GetBlueprint())
+                        {
+                            Node.CalleeGraphName = Node.CallFunctionName;
+                            Node.CalleeGraphKind = EBPGraphKind::Function;
+                        }
+                    }
+                }
+            }
+            else if (UK2Node_Composite* CompositeNode = Cast<UK2Node_Composite>(K2Node))
+            {
+                if (CompositeNode->BoundGraph)
+                {
+                    Node.CalleeGraphName = CompositeNode->BoundGraph->GetName();
+                    Node.CalleeGraphKind = EBPGraphKind::Collapsed;
+                }
+            }
+            else if (UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(K2Node))
+            {
+                Node.bIsCast = true;
+                if (CastNode->TargetType)
+                {
+                    Node.CastTargetClass = CastNode->TargetType->GetName();
+                    Node.FunctionName = Node.CastTargetClass;
+                    Node.StepSummary = FString::Printf(TEXT("Cast<%s>"), *Node.CastTargetClass);
+                }
+            }
+            else if (UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(K2Node))
+            {
+                if (UEdGraph* MacroGraph = MacroNode->GetMacroGraph())
+                {
+                    const TSharedRef<const FBPMacroSummary> Macro = FBPMacroCache::Get().FindOrSummarize(MacroGraph);
+                    Node.MacroIndex = Snapshot.Macros.IndexOfByPredicate([&Macro](const TSharedRef<const FBPMacroSummary>& Existing)
+                    {
+                        return &Existing.Get() == &Macro.Get();
+                    });
+                    if (Node.MacroIndex == INDEX_NONE)
+                    {
+                        Node.MacroIndex = Snapshot.Macros.Add(Macro);
+                    }
+
+                    Node.FunctionName = MacroGraph->GetName();
+                    Node.StepSummary = FString::Printf(TEXT("Macro: %s%s"), *Node.FunctionName, Macro->bHasLoop ? TEXT(" (loop)") : TEXT(""));
+                    Node.bIsLatent = Macro->bIsLatent;
+                }
+            }
+            else if (UK2Node_IfThenElse* BranchNode = Cast<UK2Node_IfThenElse>(K2Node))
+            {
+                Node.bIsBranch = true;
+                if (const int32* ThenIndex = PinIndices.Find(BranchNode->GetThenPin()))
+                {
+                    Node.ThenPinIndex = *ThenIndex;
+                }
+                if (const int32* ElseIndex = PinIndices.Find(BranchNode->GetElsePin()))
+                {
+                    Node.ElsePinIndex = *ElseIndex;
+                }
+            }
+
+            if (Node.StepSummary.IsEmpty())
+            {
+                Node.StepSummary = FString::Printf(TEXT("%s (%s)"), *Node.NodeType, *Node.Title);
+            }
+
+            for (UEdGraphPin* Pin : K2Node->Pins)
+            {
+                FBPPinSnapshot& PinSnapshot = Snapshot.Pins.AddDefaulted_GetRef();
+                PinSnapshot.PinName = Pin->PinName;
+                PinSnapshot.TypeString = UBlueprintAnalyzerLibrary::GetPinTypeString(Pin->PinType);
+                PinSnapshot.Direction = Pin->Direction;
+                PinSnapshot.bIsExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+                PinSnapshot.OwnerNode = NodeIndex;
+                PinSnapshot.Literal = UBlueprintAnalyzerLibrary::ExtractLiteralFromPin(Pin);
+
+                if (Pin->DefaultObject)
+                {
+                    PinSnapshot.DefaultObjectName = Pin->DefaultObject->GetName();
+                    if (UBlueprint* RefBP = Cast<UBlueprint>(Pin->DefaultObject))
+                    {
+                        PinSnapshot.DefaultBlueprintName = RefBP->GetName();
+                    }
+                }
+
+                Snapshot.PinLinkOffsets.Add(Snapshot.PinLinks.Num());
+                for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                {
+                    if (!LinkedPin || !LinkedPin->GetOwningNode()) continue;
+
+                    FBPPinLink& Link = Snapshot.PinLinks.AddDefaulted_GetRef();
+                    if (const int32* LinkedIndex = PinIndices.Find(LinkedPin))
+                    {
+                        Link.PinIndex = *LinkedIndex;
+                        Link.NodeIndex = PinOwners[*LinkedIndex - FirstPin];
+                    }
+                    else
+                    {
+                        Link.PinIndex = Snapshot.ExternalPins.Num();
+                        FBPExternalPin& External = Snapshot.ExternalPins.AddDefaulted_GetRef();
+                        External.NodeGuid = LinkedPin->GetOwningNode()->NodeGuid;
+                        External.PinName = LinkedPin->PinName;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Node-level exec/data adjacency, derived once from the pin links so passes can walk
+// the graph without scanning pins
+void FBPSnapshotAnalyzer::BuildAdjacency(FBPBlueprintSnapshot& Snapshot)
+{
+    const int32 NumNodes = Snapshot.Nodes.Num();
+    Snapshot.PinLinkOffsets.Add(Snapshot.PinLinks.Num());
+
+    Snapshot.ExecOffsets.Reset(NumNodes + 1);
+    Snapshot.DataOffsets.Reset(NumNodes + 1);
+    Snapshot.ExecTargets.Reset();
+    Snapshot.DataSources.Reset();
+
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        Snapshot.ExecOffsets.Add(Snapshot.ExecTargets.Num());
+        Snapshot.DataOffsets.Add(Snapshot.DataSources.Num());
+
+        const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+        for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+        {
+            const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+            const bool bExecOutput = Pin.bIsExec && Pin.Direction == EGPD_Output;
+            const bool bDataInput = !Pin.bIsExec && Pin.Direction == EGPD_Input;
+            if (!bExecOutput && !bDataInput) continue;
+
+            for (const FBPPinLink& Link : Snapshot.GetLinks(PinIndex))
+            {
+                if (Link.IsExternal()) continue;
+                (bExecOutput ? Snapshot.ExecTargets : Snapshot.DataSources).Add(Link.NodeIndex);
+            }
+        }
+    }
+
+    Snapshot.ExecOffsets.Add(Snapshot.ExecTargets.Num());
+    Snapshot.DataOffsets.Add(Snapshot.DataSources.Num());
+}
+
+void FBPSnapshotAnalyzer::SummarizeMacro(const FBPBlueprintSnapshot& Snapshot, FBPMacroSummary& OutSummary)
+{
+    // Loops in macros are exec cycles: a Branch on the loop condition and a Sequence that fires
+    // the body, then steps back to the Branch
+    TArray<int32> ComponentOf;
+    const TArray<TArray<int32>> Components = FBPGraphAlgo::FindStronglyConnectedComponents(Snapshot.ExecOffsets, Snapshot.ExecTargets, &ComponentOf);
+    auto IsInCycle = [&Snapshot, &Components, &ComponentOf](int32 NodeIndex)
+    {
+        return Components[ComponentOf[NodeIndex]].Num() > 1 || Snapshot.GetExecSuccessors(NodeIndex).Contains(NodeIndex);
+    };
+
+    // An exit fires once per iteration when a later output of the same Sequence continues the cycle,
+    // or when it is fed by the loop output of a nested macro
+    auto IsLoopOutput = [&Snapshot, &ComponentOf, &IsInCycle](const FBPPinLink& Source)
+    {
+        if (Source.IsExternal()) return false;
+
+        const FBPNodeSnapshot& SourceNode = Snapshot.Nodes[Source.NodeIndex];
+        if (SourceNode.MacroIndex != INDEX_NONE)
+        {
+            return Snapshot.Macros[SourceNode.MacroIndex]->IsLoopOutput(Snapshot.Pins[Source.PinIndex].PinName);
+        }
+        if (!SourceNode.bIsSequence || !IsInCycle(Source.NodeIndex)) return false;
+
+        for (int32 PinIndex = Source.PinIndex + 1; PinIndex < SourceNode.FirstPin + SourceNode.NumPins; ++PinIndex)
+        {
+            const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+            if (!Pin.bIsExec || Pin.Direction != EGPD_Output) continue;
+
+            for (const FBPPinLink& Link : Snapshot.GetLinks(PinIndex))
+            {
+                if (!Link.IsExternal() && ComponentOf[Link.NodeIndex] == ComponentOf[Source.NodeIndex]) return true;
+            }
+        }
+        return false;
+    };
+
+    for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+    {
+        const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+        if (Node.bIsTunnelEntry) continue;
+
+        if (Node.bIsTunnelExit)
+        {
+            for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+            {
+                const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+                if (!Pin.bIsExec || Pin.Direction != EGPD_Input) continue;
+
+                OutSummary.ExecOutputs.Add(Pin.PinName);
+                for (const FBPPinLink& Source : Snapshot.GetLinks(PinIndex))
+                {
+                    if (IsLoopOutput(Source))
+                    {
+                        OutSummary.LoopOutputs.AddUnique(Pin.PinName);
+                        break;
+                    }
+                }
+            }
+            continue;
+        }
+
+        OutSummary.bHasLoop |= IsInCycle(NodeIndex);
+        OutSummary.bHasBranch |= Node.bIsBranch;
+        OutSummary.bIsLatent |= Node.bIsLatent;
+        if (Node.bIsCallFunction && !Node.CallFunctionName.IsEmpty())
+        {
+            OutSummary.CalledFunctions.AddUnique(Node.CallFunctionName);
+        }
+
+        if (Node.MacroIndex == INDEX_NONE)
+        {
+            ++OutSummary.NodeCount;
+        }
+        else
+        {
+            const FBPMacroSummary& Nested = *Snapshot.Macros[Node.MacroIndex];
+            OutSummary.NodeCount += Nested.NodeCount;
+            OutSummary.bHasLoop |= Nested.bHasLoop;
+            OutSummary.bHasBranch |= Nested.bHasBranch;
+            for (const FString& FunctionName : Nested.CalledFunctions)
+            {
+                OutSummary.CalledFunctions.AddUnique(FunctionName);
+            }
+            for (const FName Package : Nested.Packages)
+            {
+                OutSummary.Packages.AddUnique(Package);
+            }
+        }
+    }
+}
+
+// Links call and collapsed nodes to the entry of the graph they run, when that graph was captured
+void FBPSnapshotAnalyzer::ResolveCallees(FBPBlueprintSnapshot& Snapshot)
+{
+    TMap<TPair<EBPGraphKind, FString>, int32> EntryNodes;
+    for (const FBPGraphSnapshot& Graph : Snapshot.Graphs)
+    {
+        if (Graph.EntryNode != INDEX_NONE && (Graph.Kind == EBPGraphKind::Function || Graph.Kind == EBPGraphKind::Collapsed))
+        {
+            EntryNodes.Add({ Graph.Kind, Graph.GraphName }, Graph.EntryNode);
+        }
+    }
+    if (EntryNodes.Num() == 0) return;
+
+    for (FBPNodeSnapshot& Node : Snapshot.Nodes)
+    {
+        if (Node.CalleeGraphName.IsEmpty()) continue;
+
+        if (const int32* EntryNode = EntryNodes.Find({ Node.CalleeGraphKind, Node.CalleeGraphName }))
+        {
+            Node.CalleeEntryNode = *EntryNode;
+        }
+    }
+}
+
+// ============================================================
+// Single-pass walk (any thread)
+// ============================================================
+
+template<typename CallbackType>
+static FORCEINLINE void TimeVisitor(bool bProfile, uint64& InOutCycles, CallbackType&& Callback)
+{
+    if (!bProfile)
+    {
+        Callback();
+        return;
+    }
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    Callback();
+    InOutCycles += FPlatformTime::Cycles64() - StartCycles;
+}
+
+void FBPSnapshotAnalyzer::Walk(const FBPBlueprintSnapshot& Snapshot, TArrayView<IBPSnapshotVisitor* const> Visitors)
+{
+    LLM_SCOPE_BYTAG(BlueprintAnalyzer);
+    TRACE_CPUPROFILER_EVENT_SCOPE(BlueprintAnalyzer_Walk);
+    SCOPE_CYCLE_COUNTER(STAT_BlueprintAnalyzer_Walk);
+
+    // Visitors share one walk, so their stages are timed per callback rather than with scopes
+    const bool bProfile = FBPStageProfiler::IsEnabled();
+    TArray<uint64, TInlineAllocator<8>> VisitorCycles;
+    VisitorCycles.SetNumZeroed(Visitors.Num());
+
+    for (int32 VisitorIndex = 0; VisitorIndex < Visitors.Num(); ++VisitorIndex)
+    {
+        TimeVisitor(bProfile, VisitorCycles[VisitorIndex], [&]() { Visitors[VisitorIndex]->BeginWalk(Snapshot); });
+    }
+
+    // Indices into Visitors
+    TArray<int32, TInlineAllocator<8>> Active;
+    for (const FBPGraphSnapshot& Graph : Snapshot.Graphs)
+    {
+        if (Graph.bIsContext) continue;
+
+        Active.Reset();
+        for (int32 VisitorIndex = 0; VisitorIndex < Visitors.Num(); ++VisitorIndex)
+        {
+            if (Visitors[VisitorIndex]->WantsGraph(Graph))
+            {
+                Active.Add(VisitorIndex);
+            }
+        }
+        if (Active.Num() == 0) continue;
+
+        for (const int32 VisitorIndex : Active)
+        {
+            TimeVisitor(bProfile, VisitorCycles[VisitorIndex], [&]() { Visitors[VisitorIndex]->BeginGraph(Snapshot, Graph); });
+        }
+
+        for (int32 NodeIndex = Graph.FirstNode; NodeIndex < Graph.FirstNode + Graph.NumNodes; ++NodeIndex)
+        {
+            const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+            for (const int32 VisitorIndex : Active)
+            {
+                TimeVisitor(bProfile, VisitorCycles[VisitorIndex], [&]() { Visitors[VisitorIndex]->VisitNode(Snapshot, NodeIndex, Node); });
+            }
+            for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+            {
+                const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+                for (const int32 VisitorIndex : Active)
+                {
+                    TimeVisitor(bProfile, VisitorCycles[VisitorIndex], [&]() { Visitors[VisitorIndex]->VisitPin(Snapshot, Node, PinIndex, Pin); });
+                }
+            }
+        }
+    }
+
+    for (int32 VisitorIndex = 0; VisitorIndex < Visitors.Num(); ++VisitorIndex)
+    {
+        TimeVisitor(bProfile, VisitorCycles[VisitorIndex], [&]() { Visitors[VisitorIndex]->EndWalk(Snapshot); });
+    }
+
+    if (bProfile)
+    {
+        for (int32 VisitorIndex = 0; VisitorIndex < Visitors.Num(); ++VisitorIndex)
+        {
+            const EBPAnalyzerStage Stage = Visitors[VisitorIndex]->GetStage();
+            if (Stage == EBPAnalyzerStage::Num) continue;
+
+            FBPStageProfiler::AddNested(Stage, VisitorCycles[VisitorIndex], 1);
+            FBPStageProfiler::SampleMemory(Stage);
+        }
+    }
+}
+
+// ============================================================
+// Phase 1: Node info + connections
+// ============================================================
+
+class FBPNodeInfoVisitor : public IBPSnapshotVisitor
+{
+public:
+    explicit FBPNodeInfoVisitor(FBlueprintAnalysisResult& InResult)
+        : Result(InResult)
+    {
+    }
+
+    virtual EBPAnalyzerStage GetStage() const override { return EBPAnalyzerStage::NodeExtraction; }
+
+    virtual void BeginWalk(const FBPBlueprintSnapshot& Snapshot) override
+    {
+        Result.BlueprintName = Snapshot.BlueprintName;
+        Result.AnalysisTimestamp = FDateTime::Now().ToString();
+        Result.Metadata = Snapshot.Metadata;
+        Result.Nodes.Reserve(Snapshot.Nodes.Num());
+    }
+
+    virtual void BeginGraph(const FBPBlueprintSnapshot& Snapshot, const FBPGraphSnapshot& Graph) override
+    {
+        GraphName = Graph.GraphName;
+    }
+
+    virtual void VisitNode(const FBPBlueprintSnapshot& Snapshot, int32 NodeIndex, const FBPNodeSnapshot& Node) override
+    {
+        FBlueprintNodeInfo& NodeInfo = Result.Nodes.AddDefaulted_GetRef();
+        NodeInfo.NodeGuid = Node.NodeGuid.ToString();
+        NodeInfo.NodeType = Node.NodeType;
+        NodeInfo.NodeName = Node.Title;
+        NodeInfo.FunctionName = Node.FunctionName;
+        NodeInfo.GraphName = GraphName;
+        NodeInfo.CommentGroup = Node.CommentGroup;
+    }
+
+    virtual void VisitPin(const FBPBlueprintSnapshot& Snapshot, const FBPNodeSnapshot& Node, int32 PinIndex, const FBPPinSnapshot& Pin) override
+    {
+        FBlueprintNodeInfo& NodeInfo = Result.Nodes.Last();
+        const FString PinEntry = FString::Printf(TEXT("%s:%s"), *Pin.PinName.ToString(), *Pin.TypeString);
+
+        if (Pin.Direction == EGPD_Input)
+        {
+            NodeInfo.InputPins.Add(PinEntry);
+            if (!Pin.Literal.IsEmpty())
+            {
+                NodeInfo.LiteralValues.Add(FString::Printf(TEXT("%s=%s"), *Pin.PinName.ToString(), *Pin.Literal));
+            }
+        }
+        else if (Pin.Direction == EGPD_Output)
+        {
+            NodeInfo.OutputPins.Add(PinEntry);
+        }
+    }
+
+private:
+    FBlueprintAnalysisResult& Result;
+    FString GraphName;
+};
+
+// One FBlueprintConnectionInfo per link, listed from the output side
+class FBPConnectionVisitor : public IBPSnapshotVisitor
+{
+public:
+    explicit FBPConnectionVisitor(FBlueprintAnalysisResult& InResult)
+        : Result(InResult)
+    {
+    }
+
+    virtual EBPAnalyzerStage GetStage() const override { return EBPAnalyzerStage::ConnectionExtraction; }
+
+    virtual void VisitPin(const FBPBlueprintSnapshot& Snapshot, const FBPNodeSnapshot& Node, int32 PinIndex, const FBPPinSnapshot& Pin) override
+    {
+        if (Pin.Direction != EGPD_Output) return;
+
+        for (const FBPPinLink& Link : Snapshot.GetLinks(PinIndex))
+        {
+            // Most nodes have no outgoing links, so the GUID string is only built on first use
+            if (GuidNode != &Node)
+            {
+                GuidNode = &Node;
+                NodeGuid = Node.NodeGuid.ToString();
+            }
+
+            FBlueprintConnectionInfo& ConnectionInfo = Result.Connections.AddDefaulted_GetRef();
+            ConnectionInfo.FromNodeGuid = NodeGuid;
+            ConnectionInfo.FromPinName = Pin.PinName.ToString();
+            ConnectionInfo.ToNodeGuid = Snapshot.GetLinkedNodeGuid(Link).ToString();
+            ConnectionInfo.ToPinName = Snapshot.GetLinkedPinName(Link).ToString();
+        }
+    }
+
+private:
+    FBlueprintAnalysisResult& Result;
+    const FBPNodeSnapshot* GuidNode = nullptr;
+    FString NodeGuid;
+};
+
+// Project summaries count every node (comments included) in event + function graphs
+class FBPSummaryNodeCountVisitor : public IBPSnapshotVisitor
+{
+public:
+    explicit FBPSummaryNodeCountVisitor(int32& InNodeCount)
+        : NodeCount(InNodeCount)
+    {
+    }
+
+    virtual bool WantsGraph(const FBPGraphSnapshot& Graph) const override
+    {
+        return Graph.Kind == EBPGraphKind::Ubergraph || Graph.Kind == EBPGraphKind::Function;
+    }
+
+    virtual void BeginGraph(const FBPBlueprintSnapshot& Snapshot, const FBPGraphSnapshot& Graph) override
+    {
+        NodeCount += Graph.TotalNodeCount;
+    }
+
+private:
+    int32& NodeCount;
+};
+
+// ============================================================
+// Phase 2: Execution Flow Tracing
+// ============================================================
+
+static int32 TraceMaxDepth = 0;
+static FAutoConsoleVariableRef CVarTraceMaxDepth(
+    TEXT("BlueprintAnalyzer.TraceMaxDepth"),
+    TraceMaxDepth,
+    TEXT("Nested branch depth at which execution tracing stops and marks the path truncated (0 = unlimited)."));
+
+static int32 TraceMaxSteps = 0;
+static FAutoConsoleVariableRef CVarTraceMaxSteps(
+    TEXT("BlueprintAnalyzer.TraceMaxSteps"),
+    TraceMaxSteps,
+    TEXT("Steps per execution path after which tracing stops and marks the path truncated (0 = unlimited)."));
+
+static int32 TraceCallDepth = 0;
+static FAutoConsoleVariableRef CVarTraceCallDepth(
+    TEXT("BlueprintAnalyzer.TraceCallDepth"),
+    TraceCallDepth,
+    TEXT("Nested calls into the Blueprint's own functions and collapsed graphs that execution tracing expands inline (0 = none)."));
+
+FBPTraceLimits FBPTraceLimits::FromConsoleVariables()
+{
+    FBPTraceLimits Limits;
+    Limits.MaxDepth = FMath::Max(TraceMaxDepth, 0);
+    Limits.MaxStepsPerPath = FMath::Max(TraceMaxSteps, 0);
+    Limits.MaxCallDepth = FMath::Max(TraceCallDepth, 0);
+    return Limits;
+}
+
+static FName GetSequenceLabel(int32 OutputIndex)
+{
+    static const TArray<FName> Labels = []()
+    {
+        TArray<FName> Out;
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            Out.Add(FName(*FString::Printf(TEXT("Then %d"), Index)));
+        }
+        return Out;
+    }();
+
+    return Labels.IsValidIndex(OutputIndex) ? Labels[OutputIndex] : FName(*FString::Printf(TEXT("Then %d"), OutputIndex));
+}
+
+// Depth-first tracer over an explicit stack. Pending starts are pushed in reverse so they
+// pop in the order a recursive walk would reach them: branch outputs first, then the rest
+// of the current chain. Visited marks are stamped per path, so a new path costs O(1).
+//
+// Flow that more than one entry reaches (a custom event chain several events fall into, a
+// shared handler) is traced once as a segment rooted at the node where the flows meet; the
+// paths reaching it get a reference step there instead of a copy of the whole chain.
+//
+// With a MaxCallDepth, calls into the Blueprint's own functions and collapsed graphs are
+// expanded afterwards: every callee body is traced once (a function's body is its own path)
+// and its steps are copied under each call site, nested up to MaxCallDepth. A call to a body
+// already being expanded around it is marked recursive and left unexpanded.
+class FBPExecTracer
+{
+public:
+    FBPExecTracer(const FBPBlueprintSnapshot& InSnapshot, const FBPTraceLimits& InLimits, FBPTraceSet& InTrace)
+        : Snapshot(InSnapshot)
+        , Limits(InLimits)
+        , Trace(InTrace)
+    {
+        VisitStamps.SetNumZeroed(Snapshot.Nodes.Num());
+        SegmentOf.Init(INDEX_NONE, Snapshot.Nodes.Num());
+    }
+
+    void Run(const TArray<int32>& EntryNodes)
+    {
+        FindSegmentRoots(EntryNodes);
+
+        for (const int32 EntryNode : EntryNodes)
+        {
+            const FBPTracePath Path = TracePath(EntryNode);
+            if (Path.NumSteps > 0)
+            {
+                Trace.Paths.Add(Path);
+            }
+        }
+
+        // Every segment starts with its root step, and references rely on its position
+        for (const int32 RootNode : SegmentRoots)
+        {
+            Trace.Segments.Add(TracePath(RootNode));
+        }
+
+        if (Limits.MaxCallDepth > 0)
+        {
+            ExpandCalls();
+        }
+    }
+
+private:
+    struct FPendingStep
+    {
+        int32 NodeIndex;
+        int32 Depth;
+        FName BranchLabel;
+    };
+
+    // Passes allowed to refine the roots; real graphs settle in two or three
+    static constexpr int32 MaxRootPasses = 8;
+
+    // A node becomes a segment root when walks from two different sources (the entries, then
+    // the roots found so far) both reach it. Each walk stops at known roots and claims the
+    // nodes it reaches first, so a pass is linear in graph size. A root found mid-pass leaves
+    // the nodes behind it claimed by whichever source got there first; the next pass starts
+    // from the new roots too and sorts that out, until a pass adds no root. Stopping early
+    // only leaves some flow repeated, never missing.
+    void FindSegmentRoots(const TArray<int32>& EntryNodes)
+    {
+        TArray<int32> Sources = EntryNodes;
+        TBitArray<> IsRoot(false, Snapshot.Nodes.Num());
+        TArray<int32> Owners;
+
+        for (int32 Pass = 0; Pass < MaxRootPasses; ++Pass)
+        {
+            Owners.Init(INDEX_NONE, Snapshot.Nodes.Num());
+
+            const int32 NumSources = Sources.Num();
+            for (int32 SourceIndex = 0; SourceIndex < NumSources; ++SourceIndex)
+            {
+                const int32 Source = Sources[SourceIndex];
+                Owners[Source] = Source;
+
+                Stack.Reset();
+                Stack.Add({ Source, 0, NAME_None });
+                while (Stack.Num() > 0)
+                {
+                    GatherSuccessors(Stack.Pop(EAllowShrinking::No));
+                    for (const FPendingStep& Next : Successors)
+                    {
+                        if (Next.NodeIndex == INDEX_NONE || IsRoot[Next.NodeIndex]) continue;
+
+                        int32& Owner = Owners[Next.NodeIndex];
+                        if (Owner == INDEX_NONE)
+                        {
+                            Owner = Source;
+                            Stack.Add(Next);
+                        }
+                        else if (Owner != Source)
+                        {
+                            IsRoot[Next.NodeIndex] = true;
+                            Sources.Add(Next.NodeIndex);
+                        }
+                    }
+                }
+            }
+
+            if (Sources.Num() == NumSources) break;
+        }
+
+        SegmentRoots.Append(Sources.GetData() + EntryNodes.Num(), Sources.Num() - EntryNodes.Num());
+        SegmentRoots.Sort();
+        for (int32 SegmentIndex = 0; SegmentIndex < SegmentRoots.Num(); ++SegmentIndex)
+        {
+            SegmentOf[SegmentRoots[SegmentIndex]] = SegmentIndex;
+        }
+    }
+
+    FBPTracePath TracePath(int32 StartNode)
+    {
+        ++Stamp;
+
+        FBPTracePath Path;
+        Path.EntryNode = StartNode;
+        Path.FirstStep = Trace.Steps.Num();
+
+        Stack.Reset();
+        Stack.Add({ StartNode, 0, NAME_None });
+        while (Stack.Num() > 0)
+        {
+            const FPendingStep Pending = Stack.Pop(EAllowShrinking::No);
+
+            // Exec links to non-K2 nodes have no index and end the chain
+            if (Pending.NodeIndex == INDEX_NONE) continue;
+
+            FBPTraceStep& Step = Trace.Steps.AddDefaulted_GetRef();
+            Step.NodeIndex = Pending.NodeIndex;
+            Step.Depth = Pending.Depth;
+            Step.BranchLabel = Pending.BranchLabel;
+
+            const bool bDepthLimit = Limits.MaxDepth > 0 && Pending.Depth > Limits.MaxDepth;
+            const bool bStepLimit = Limits.MaxStepsPerPath > 0 && Trace.Steps.Num() - Path.FirstStep > Limits.MaxStepsPerPath;
+            if (bDepthLimit || bStepLimit)
+            {
+                Step.bIsTerminator = true;
+                Step.bIsTruncated = true;
+                Path.bTruncated = true;
+
+                // A full path takes no more steps; a deep branch only loses its own subtree
+                if (bStepLimit) break;
+                continue;
+            }
+
+            // Shared flow is referenced, not traced again
+            if (SegmentOf[Pending.NodeIndex] != INDEX_NONE && Pending.NodeIndex != StartNode)
+            {
+                Step.bIsTerminator = true;
+                Step.SegmentIndex = SegmentOf[Pending.NodeIndex];
+                continue;
+            }
+
+            // A node we've already visited gets a loopback marker and ends the chain
+            if (VisitStamps[Pending.NodeIndex] == Stamp)
+            {
+                Step.bIsTerminator = true;
+                continue;
+            }
+            VisitStamps[Pending.NodeIndex] = Stamp;
+
+            GatherSuccessors(Pending);
+            for (int32 Index = Successors.Num() - 1; Index >= 0; --Index)
+            {
+                Stack.Add(Successors[Index]);
+            }
+        }
+
+        Path.NumSteps = Trace.Steps.Num() - Path.FirstStep;
+        return Path;
+    }
+
+    // Fills Successors in trace order
+    void GatherSuccessors(const FPendingStep& Current)
+    {
+        const FBPNodeSnapshot& Node = Snapshot.Nodes[Current.NodeIndex];
+        const int32 BranchDepth = Current.Depth + 1;
+        Successors.Reset();
+
+        // Branch handling: Branch (IfThenElse), Sequence, Cast with success/fail
+        if (Node.bIsBranch)
+        {
+            static const FName TrueLabel(TEXT("True"));
+            static const FName FalseLabel(TEXT("False"));
+
+            if (Node.ThenPinIndex != INDEX_NONE)
+            {
+                for (const FBPPinLink& Link : Snapshot.GetLinks(Node.ThenPinIndex))
+                {
+                    Successors.Add({ Link.NodeIndex, BranchDepth, TrueLabel });
+                }
+            }
+            if (Node.ElsePinIndex != INDEX_NONE)
+            {
+                for (const FBPPinLink& Link : Snapshot.GetLinks(Node.ElsePinIndex))
+                {
+                    Successors.Add({ Link.NodeIndex, BranchDepth, FalseLabel });
+                }
+            }
+        }
+        else if (Node.bIsSequence)
+        {
+            int32 BranchIdx = 0;
+            for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+            {
+                const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+                if (Pin.Direction == EGPD_Output && Pin.bIsExec)
+                {
+                    const FName ThenLabel = GetSequenceLabel(BranchIdx);
+                    for (const FBPPinLink& Link : Snapshot.GetLinks(PinIndex))
+                    {
+                        Successors.Add({ Link.NodeIndex, BranchDepth, ThenLabel });
+                    }
+                    BranchIdx++;
+                }
+            }
+        }
+        else if (Node.MacroIndex != INDEX_NONE && Snapshot.Macros[Node.MacroIndex]->ExecOutputs.Num() > 1)
+        {
+            // Macro with several exits (loop body / completed, gate, branch): each exit is a labeled branch
+            for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+            {
+                const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+                if (Pin.Direction == EGPD_Output && Pin.bIsExec)
+                {
+                    for (const FBPPinLink& Link : Snapshot.GetLinks(PinIndex))
+                    {
+                        Successors.Add({ Link.NodeIndex, BranchDepth, Pin.PinName });
+                    }
+                }
+            }
+        }
+        else
+        {
+            // Default: follow the first linked exec output. Extra links on that pin (e.g. SpawnActor
+            // success/fail, Cast) are traced as branches before the chain continues at the same depth.
+            for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+            {
+                const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+                const TConstArrayView<FBPPinLink> Links = Snapshot.GetLinks(PinIndex);
+                if (Pin.Direction == EGPD_Output && Pin.bIsExec && Links.Num() > 0)
+                {
+                    for (int32 i = 1; i < Links.Num(); ++i)
+                    {
+                        Successors.Add({ Links[i].NodeIndex, BranchDepth, Pin.PinName });
+                    }
+                    Successors.Add({ Links[0].NodeIndex, Current.Depth, NAME_None });
+                    break;
+                }
+            }
+        }
+    }
+
+    void ExpandCalls()
+    {
+        // Callee bodies, traced once; function bodies are the paths from their FunctionEntry
+        for (const FBPTracePath& Path : Trace.Paths)
+        {
+            Bodies.Add(Path.EntryNode, Path);
+        }
+        for (const FBPNodeSnapshot& Node : Snapshot.Nodes)
+        {
+            if (Node.CalleeEntryNode != INDEX_NONE && !Bodies.Contains(Node.CalleeEntryNode))
+            {
+                Bodies.Add(Node.CalleeEntryNode, TracePath(Node.CalleeEntryNode));
+            }
+        }
+
+        // Rebuild the step array with the bodies copied in; bodies traced only for expansion drop out
+        const TArray<FBPTraceStep> TracedSteps = MoveTemp(Trace.Steps);
+        Trace.Steps.Reset(TracedSteps.Num());
+        for (FBPTracePath& Path : Trace.Paths)
+        {
+            ExpandPath(TracedSteps, Path);
+        }
+        for (FBPTracePath& Segment : Trace.Segments)
+        {
+            ExpandPath(TracedSteps, Segment);
+        }
+    }
+
+    void ExpandPath(const TArray<FBPTraceStep>& TracedSteps, FBPTracePath& Path)
+    {
+        const FBPTracePath Traced = Path;
+        Path.FirstStep = Trace.Steps.Num();
+
+        CallStack.Reset();
+        CallStack.Add(Path.EntryNode);
+        AppendSteps(TracedSteps, Traced, 0, 0, 0, Path);
+
+        Path.NumSteps = Trace.Steps.Num() - Path.FirstStep;
+    }
+
+    // Recurses once per expanded call, so at most MaxCallDepth deep
+    void AppendSteps(const TArray<FBPTraceStep>& TracedSteps, const FBPTracePath& Body, int32 FirstBodyStep, int32 DepthOffset, int32 CallDepth,
+        FBPTracePath& Path)
+    {
+        for (int32 StepIndex = Body.FirstStep + FirstBodyStep; StepIndex < Body.FirstStep + Body.NumSteps; ++StepIndex)
+        {
+            FBPTraceStep Step = TracedSteps[StepIndex];
+            Step.Depth += DepthOffset;
+            Step.CallDepth = CallDepth;
+
+            const int32 CalleeEntry = Step.bIsTerminator ? INDEX_NONE : Snapshot.Nodes[Step.NodeIndex].CalleeEntryNode;
+            Step.bIsRecursiveCall = CalleeEntry != INDEX_NONE && CallStack.Contains(CalleeEntry);
+            Trace.Steps.Add(Step);
+
+            if (CalleeEntry == INDEX_NONE || Step.bIsRecursiveCall || CallDepth >= Limits.MaxCallDepth) continue;
+            if (Limits.MaxStepsPerPath > 0 && Trace.Steps.Num() - Path.FirstStep >= Limits.MaxStepsPerPath) continue;
+
+            const FBPTracePath* Callee = Bodies.Find(CalleeEntry);
+            if (!Callee) continue;
+
+            // The callee's entry step stands for the call itself, which is already listed
+            Path.bTruncated |= Callee->bTruncated;
+            CallStack.Push(CalleeEntry);
+            AppendSteps(TracedSteps, *Callee, 1, Step.Depth + 1, CallDepth + 1, Path);
+            CallStack.Pop(EAllowShrinking::No);
+        }
+    }
+
+    const FBPBlueprintSnapshot& Snapshot;
+    const FBPTraceLimits& Limits;
+    FBPTraceSet& Trace;
+
+    TArray<FPendingStep> Stack;
+    TArray<FPendingStep> Successors;
+    TArray<uint32> VisitStamps;
+    uint32 Stamp = 0;
+
+    TArray<int32> SegmentRoots;
+    TArray<int32> SegmentOf;
+
+    // Callee entry node -> its traced body, and the bodies being expanded around the current step
+    TMap<int32, FBPTracePath> Bodies;
+    TArray<int32> CallStack;
+};
+
+FBPTraceSet FBPSnapshotAnalyzer::TraceCompact(const FBPBlueprintSnapshot& Snapshot, const FBPTraceLimits& Limits)
+{
+    BPA_STAGE_SCOPE(Tracing);
+
+    TArray<int32> EntryNodes;
+    for (const FBPGraphSnapshot& Graph : Snapshot.Graphs)
+    {
+        // Events can sit inside collapsed graphs of the event graph
+        if (Graph.Kind != EBPGraphKind::Ubergraph && Graph.Kind != EBPGraphKind::Function && Graph.Kind != EBPGraphKind::Collapsed) continue;
+
+        for (int32 NodeIndex = Graph.FirstNode; NodeIndex < Graph.FirstNode + Graph.NumNodes; ++NodeIndex)
+        {
+            const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+
+            // Entry points: Event, CustomEvent, FunctionEntry
+            if (Node.bIsEvent || Node.bIsFunctionEntry)
+            {
+                EntryNodes.Add(NodeIndex);
+            }
+        }
+    }
+
+    FBPTraceSet Trace;
+    FBPExecTracer Tracer(Snapshot, Limits, Trace);
+    Tracer.Run(EntryNodes);
+    return Trace;
+}
+
+const TCHAR* FBPSnapshotAnalyzer::GetStepSummaryPrefix(const FBPTraceStep& Step)
+{
+    if (Step.bIsTruncated) return TEXT("-> not traced: ");
+    if (Step.SegmentIndex != INDEX_NONE) return TEXT("-> ");
+    if (Step.bIsTerminator) return TEXT("-> back to ");
+    return TEXT("");
+}
+
+FExecutionPath FBPSnapshotAnalyzer::ToExecutionPath(const FBPBlueprintSnapshot& Snapshot, const FBPTraceSet& Trace, const FBPTracePath& Path)
+{
+    const FBPNodeSnapshot& EntryNode = Snapshot.Nodes[Path.EntryNode];
+
+    FExecutionPath Out;
+    Out.EntryPointName = EntryNode.Title;
+    Out.EntryNodeGuid = EntryNode.NodeGuid.ToString();
+    Out.GraphName = Snapshot.GetGraph(EntryNode).GraphName;
+    Out.bTruncated = Path.bTruncated;
+    Out.Steps.Reserve(Path.NumSteps);
+
+    for (const FBPTraceStep& TraceStep : Trace.GetSteps(Path))
+    {
+        const FBPNodeSnapshot& Node = Snapshot.Nodes[TraceStep.NodeIndex];
+
+        FExecutionStep& Step = Out.Steps.AddDefaulted_GetRef();
+        Step.NodeGuid = Node.NodeGuid.ToString();
+        if (!TraceStep.BranchLabel.IsNone())
+        {
+            Step.BranchLabel = TraceStep.BranchLabel.ToString();
+        }
+        Step.Depth = TraceStep.Depth;
+        Step.CallDepth = TraceStep.CallDepth;
+
+        Step.Summary = GetStepSummaryPrefix(TraceStep);
+        Step.Summary += Node.StepSummary;
+
+        if (TraceStep.bIsTruncated)
+        {
+            Step.NodeType = TEXT("Truncated");
+            Step.bIsTerminator = true;
+            Step.bIsTruncated = true;
+        }
+        else if (TraceStep.SegmentIndex != INDEX_NONE)
+        {
+            Step.NodeType = TEXT("SharedSegment");
+            Step.bIsTerminator = true;
+            Step.bIsSharedSegment = true;
+        }
+        else if (TraceStep.bIsTerminator)
+        {
+            Step.NodeType = TEXT("Loopback");
+            Step.bIsTerminator = true;
+        }
+        else
+        {
+            Step.NodeType = Node.NodeType;
+            Step.bIsLatent = Node.bIsLatent;
+            Step.bIsRecursiveCall = TraceStep.bIsRecursiveCall;
+        }
+    }
+
+    return Out;
+}
+
+void FBPSnapshotAnalyzer::TraceExecutionPaths(const FBPBlueprintSnapshot& Snapshot, TArray<FExecutionPath>& OutPaths, TArray<FExecutionPath>& OutSharedSegments,
+    const FBPTraceLimits& Limits)
+{
+    BPA_STAGE_SCOPE(Tracing);
+
+    const FBPTraceSet Trace = TraceCompact(Snapshot, Limits);
+
+    // Context graphs are traced so calls into them expand, but their own paths are not listed
+    OutPaths.Reset(Trace.Paths.Num());
+    for (const FBPTracePath& Path : Trace.Paths)
+    {
+        if (!Snapshot.GetGraph(Snapshot.Nodes[Path.EntryNode]).bIsContext)
+        {
+            OutPaths.Add(ToExecutionPath(Snapshot, Trace, Path));
+        }
+    }
+
+    OutSharedSegments.Reset(Trace.Segments.Num());
+    for (const FBPTracePath& Segment : Trace.Segments)
+    {
+        if (!Snapshot.GetGraph(Snapshot.Nodes[Segment.EntryNode]).bIsContext)
+        {
+            OutSharedSegments.Add(ToExecutionPath(Snapshot, Trace, Segment));
+        }
+    }
+}
+
+// ============================================================
+// Phase 3: Blueprint Performance Analysis
+// ============================================================
+
+// Detect expensive function calls that are known performance anti-patterns
+static bool IsExpensiveFunctionCall(const FString& FuncName)
+{
+    if (FuncName.IsEmpty()) return false;
+
+    static const TArray<FString> ExpensiveFunctions = {
+        TEXT("GetAllActorsOfClass"),
+        TEXT("GetAllActorsWithInterface"),
+        TEXT("GetAllActorsWithTag"),
+        TEXT("GetAllWidgetsOfClass"),
+        TEXT("LineTraceSingle"),
+        TEXT("LineTraceMulti"),
+        TEXT("SphereTraceSingle"),
+        TEXT("SphereTraceMulti"),
+    };
+
+    for (const FString& Expensive : ExpensiveFunctions)
+    {
+        if (FuncName.Contains(Expensive)) return true;
+    }
+
+    return false;
+}
+
+// Walks exec-flow downstream from an event node and collects every reachable K2Node
+static void CollectReachableNodes(const FBPBlueprintSnapshot& Snapshot, int32 Start, TArray<int32>& OutOrdered, TBitArray<>& InOutVisited)
+{
+    if (Start == INDEX_NONE || InOutVisited[Start]) return;
+
+    TArray<int32> Stack;
+    Stack.Push(Start);
+
+    while (Stack.Num() > 0)
+    {
+        const int32 Current = Stack.Pop();
+        if (InOutVisited[Current]) continue;
+        InOutVisited[Current] = true;
+        OutOrdered.Add(Current);
+
+        for (int32 Next : Snapshot.GetExecSuccessors(Current))
+        {
+            Stack.Push(Next);
+        }
+    }
+}
+
+// Nodes one run of Nodes executes; a macro instance counts as the nodes of its body
+static int32 CountExecutedNodes(const FBPBlueprintSnapshot& Snapshot, const TArray<int32>& Nodes)
+{
+    int32 Count = 0;
+    for (const int32 NodeIndex : Nodes)
+    {
+        const int32 MacroIndex = Snapshot.Nodes[NodeIndex].MacroIndex;
+        Count += MacroIndex != INDEX_NONE ? Snapshot.Macros[MacroIndex]->NodeCount : 1;
+    }
+    return Count;
+}
+
+// Rules 1 and 2 report at most this many nodes each, and so do the hot loop rules
+static constexpr int32 MaxTickIssuesPerRule = 3;
+
+// Array operations that scan the array; inside a loop over another collection they make it O(n*m)
+static bool IsLinearArrayOperation(const FString& FuncName)
+{
+    static const TCHAR* LinearOperations[] = {
+        TEXT("Array_Find"),
+        TEXT("Array_Contains"),
+        TEXT("Array_Remove"),
+        TEXT("Array_AddUnique"),
+    };
+
+    for (const TCHAR* Operation : LinearOperations)
+    {
+        if (FuncName.Contains(Operation)) return true;
+    }
+    return false;
+}
+
+static bool IsActorQuery(const FString& FuncName)
+{
+    return FuncName.Contains(TEXT("GetAllActors")) || FuncName.Contains(TEXT("GetAllWidgetsOfClass"));
+}
+
+// Entries a looping timer set by Setter runs: the event bound to its delegate, or the event or
+// function its FunctionName literal names. A timer whose Looping pin is unset runs once.
+static void CollectTimerTargets(const FBPBlueprintSnapshot& Snapshot, const FBPNodeSnapshot& Setter, TArray<int32>& InOutEntries)
+{
+    TArray<int32, TInlineAllocator<2>> Targets;
+    FString FunctionName;
+    for (int32 PinIndex = Setter.FirstPin; PinIndex < Setter.FirstPin + Setter.NumPins; ++PinIndex)
+    {
+        const FBPPinSnapshot& Pin = Snapshot.Pins[PinIndex];
+        if (Pin.PinName == TEXT("bLooping") && Pin.Literal.Equals(TEXT("false"), ESearchCase::IgnoreCase)) return;
+
+        if (Pin.PinName == TEXT("FunctionName"))
+        {
+            FunctionName = Pin.Literal;
+        }
+        else if (Pin.PinName == TEXT("Event"))
+        {
+            for (const FBPPinLink& Link : Snapshot.GetLinks(PinIndex))
+            {
+                if (!Link.IsExternal() && Snapshot.Nodes[Link.NodeIndex].bIsEvent)
+                {
+                    Targets.Add(Link.NodeIndex);
+                }
+            }
+        }
+    }
+
+    if (!FunctionName.IsEmpty())
+    {
+        for (const FBPGraphSnapshot& Graph : Snapshot.Graphs)
+        {
+            if (Graph.Kind == EBPGraphKind::Function && Graph.EntryNode != INDEX_NONE && Graph.GraphName == FunctionName)
+            {
+                Targets.Add(Graph.EntryNode);
+            }
+        }
+        for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+        {
+            if (Snapshot.Nodes[NodeIndex].bIsEvent && Snapshot.Nodes[NodeIndex].Title == FunctionName)
+            {
+                Targets.Add(NodeIndex);
+            }
+        }
+    }
+
+    for (const int32 Target : Targets)
+    {
+        InOutEntries.AddUnique(Target);
+    }
+}
+
+// Reports keep the entry and the steps closest to the finding
+static constexpr int32 MaxEntryPathSteps = 12;
+
+static TArray<FString> BuildEntryPath(const FBPBlueprintSnapshot& Snapshot, const FBPExecReach& Reach, int32 NodeIndex)
+{
+    TArray<int32> Chain;
+    TSet<int32> InChain;
+    for (int32 Current = NodeIndex; Current != INDEX_NONE; )
+    {
+        bool bAlreadyInChain = false;
+        InChain.Add(Current, &bAlreadyInChain);
+        if (bAlreadyInChain) break;
+
+        Chain.Add(Current);
+        const int32* Parent = Reach.Parent.Find(Current);
+        Current = Parent ? *Parent : INDEX_NONE;
+    }
+    Algo::Reverse(Chain);
+
+    TArray<FString> Path;
+    Path.Add(Snapshot.Nodes[Chain[0]].Title);
+
+    const int32 NumSkipped = FMath::Max(Chain.Num() - MaxEntryPathSteps, 0);
+    if (NumSkipped > 0)
+    {
+        Path.Add(FString::Printf(TEXT("... (%d steps)"), NumSkipped));
+    }
+    for (int32 Index = 1 + NumSkipped; Index < Chain.Num(); ++Index)
+    {
+        Path.Add(Snapshot.Nodes[Chain[Index]].StepSummary);
+    }
+    return Path;
+}
+
+// Call matching Matches that feeds NodeIndex's data inputs directly or through pure nodes.
+// An impure producer ends the search past it: its outputs are values cached when it ran.
+static int32 FindCallFeeding(const FBPBlueprintSnapshot& Snapshot, const FBPCostModel& CostModel, int32 NodeIndex, bool (*Matches)(const FString&))
+{
+    TSet<int32, DefaultKeyFuncs<int32>, TInlineSetAllocator<16>> Seen;
+    TArray<int32, TInlineAllocator<16>> Stack;
+    Stack.Append(Snapshot.GetDataSources(NodeIndex).GetData(), Snapshot.GetDataSources(NodeIndex).Num());
+
+    while (Stack.Num() > 0)
+    {
+        const int32 SourceIndex = Stack.Pop(EAllowShrinking::No);
+        bool bAlreadySeen = false;
+        Seen.Add(SourceIndex, &bAlreadySeen);
+        if (bAlreadySeen) continue;
+
+        const FBPNodeSnapshot& Source = Snapshot.Nodes[SourceIndex];
+        if (Source.bIsCallFunction && Matches(Source.CallFunctionName)) return SourceIndex;
+        if (!CostModel.IsPureNode(SourceIndex)) continue;
+
+        for (const int32 Next : Snapshot.GetDataSources(SourceIndex))
+        {
+            Stack.Push(Next);
+        }
+    }
+    return INDEX_NONE;
+}
+
+// Starts a hot loop finding on FoundNode (ReachedNode or a pure node feeding it) unless its rule is
+// at the cap or another entry already reported the node
+static FBPPerformanceIssue* AddHotLoopIssue(TArray<FBPPerformanceIssue>& Issues, const FBPBlueprintSnapshot& Snapshot, const FBPExecReach& Reach,
+    int32 ReachedNode, int32 FoundNode)
+{
+    if (Issues.Num() >= MaxTickIssuesPerRule) return nullptr;
+
+    const FBPNodeSnapshot& Node = Snapshot.Nodes[FoundNode];
+    const FString NodeGuid = Node.NodeGuid.ToString();
+    if (Issues.ContainsByPredicate([&NodeGuid](const FBPPerformanceIssue& Issue) { return Issue.NodeGuid == NodeGuid; })) return nullptr;
+
+    FBPPerformanceIssue& Issue = Issues.AddDefaulted_GetRef();
+    Issue.NodeGuid = NodeGuid;
+    Issue.GraphName = Snapshot.GetGraph(Node).GraphName;
+    Issue.EntryPath = BuildEntryPath(Snapshot, Reach, ReachedNode);
+    if (FoundNode != ReachedNode)
+    {
+        Issue.EntryPath.Add(FString::Printf(TEXT("(input) %s"), *Node.StepSummary));
+    }
+    return &Issue;
+}
+
+// Collects the perf rule inputs; the Blueprint-wide rules run in ApplyPerformanceRules
+class FBPPerformanceFactsVisitor : public IBPSnapshotVisitor
+{
+public:
+    virtual EBPAnalyzerStage GetStage() const override { return EBPAnalyzerStage::PerfRules; }
+
+    // Perf rules only look at event graphs
+    virtual bool WantsGraph(const FBPGraphSnapshot& Graph) const override
+    {
+        return Graph.Kind == EBPGraphKind::Ubergraph;
+    }
+
+    virtual void BeginWalk(const FBPBlueprintSnapshot& Snapshot) override
+    {
+        TickVisited.Init(false, Snapshot.Nodes.Num());
+        BeginPlayVisited.Init(false, Snapshot.Nodes.Num());
+    }
+
+    virtual void BeginGraph(const FBPBlueprintSnapshot& Snapshot, const FBPGraphSnapshot& Graph) override
+    {
+        Facts.TotalNodes += Graph.NumNodes;
+    }
+
+    virtual void VisitNode(const FBPBlueprintSnapshot& Snapshot, int32 NodeIndex, const FBPNodeSnapshot& Node) override
+    {
+        // Gather nodes reachable from Tick/BeginPlay
+        if (Node.bIsTickEvent)
+        {
+            CollectReachableNodes(Snapshot, NodeIndex, TickNodes, TickVisited);
+            TickEvents.Add(NodeIndex);
+            HotEntries.AddUnique(NodeIndex);
+        }
+        else if (Node.bIsBeginPlayEvent)
+        {
+            CollectReachableNodes(Snapshot, NodeIndex, BeginPlayNodes, BeginPlayVisited);
+        }
+        if (Node.bIsEvent)
+        {
+            Facts.EventCount++;
+        }
+        if (Node.bIsCast)
+        {
+            Facts.CastCount++;
+        }
+        // Hot entries stay in graph order, so per-graph facts merge in the same order
+        if (IsTimerSetter(Node))
+        {
+            CollectTimerTargets(Snapshot, Node, HotEntries);
+        }
+    }
+
+    virtual void EndWalk(const FBPBlueprintSnapshot& Snapshot) override
+    {
+        Facts.TickNodeCount += CountExecutedNodes(Snapshot, TickNodes);
+        Facts.BeginPlayNodeCount += CountExecutedNodes(Snapshot, BeginPlayNodes);
+
+        if (HotEntries.Num() > 0)
+        {
+            FBPCostModel CostModel(Snapshot);
+            for (const int32 EventIndex : TickEvents)
+            {
+                Facts.TickPathCosts.Add(CostModel.EstimatePath(EventIndex));
+            }
+
+            // Rules 6-9: loops on paths that run every frame, from Tick or a looping timer,
+            // including the Blueprint's own functions and collapsed graphs they call
+            for (const int32 EntryIndex : HotEntries)
+            {
+                FBPExecReach Reach;
+                CostModel.Reach(EntryIndex, true, Reach);
+                AddHotLoopIssues(Snapshot, CostModel, EntryIndex, Reach);
+            }
+        }
+
+        // Rule 1: expensive calls inside Tick, directly or inside a macro body (-25 each, cap at 3)
+        auto AddTickCallIssue = [&Snapshot, this](const FBPNodeSnapshot& Node, const FString& Description)
+        {
+            FBPPerformanceIssue& Issue = Facts.TickCallIssues.AddDefaulted_GetRef();
+            Issue.IssueType = TEXT("Expensive Call in Tick");
+            Issue.Description = Description;
+            Issue.Recommendation = TEXT("Cache the result in BeginPlay, use a timer, or event-driven alternative (-25 points)");
+            Issue.Severity = EBPPerformanceSeverity::Critical;
+            Issue.NodeGuid = Node.NodeGuid.ToString();
+            Issue.Deduction = 25;
+            Issue.GraphName = Snapshot.GetGraph(Node).GraphName;
+        };
+        for (int32 NodeIndex : TickNodes)
+        {
+            if (Facts.TickCallIssues.Num() >= MaxTickIssuesPerRule) break;
+
+            const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+            if (Node.bIsCallFunction && IsExpensiveFunctionCall(Node.CallFunctionName))
+            {
+                AddTickCallIssue(Node, FString::Printf(TEXT("'%s' is called every frame inside Tick"), *Node.CallFunctionName));
+            }
+            else if (Node.MacroIndex != INDEX_NONE)
+            {
+                const FBPMacroSummary& Macro = *Snapshot.Macros[Node.MacroIndex];
+                for (const FString& FunctionName : Macro.CalledFunctions)
+                {
+                    if (Facts.TickCallIssues.Num() >= MaxTickIssuesPerRule) break;
+                    if (!IsExpensiveFunctionCall(FunctionName)) continue;
+
+                    AddTickCallIssue(Node, FString::Printf(TEXT("'%s' is called every frame inside Tick (in macro %s)"), *FunctionName, *Macro.MacroName));
+                }
+            }
+        }
+
+        // Rule 2: Cast node inside Tick (-10 each, cap at 3)
+        for (int32 NodeIndex : TickNodes)
+        {
+            if (Facts.TickCastIssues.Num() >= MaxTickIssuesPerRule) break;
+
+            const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+            if (Node.bIsCast)
+            {
+                FBPPerformanceIssue& Issue = Facts.TickCastIssues.AddDefaulted_GetRef();
+                Issue.IssueType = TEXT("Cast in Tick");
+                Issue.Description = TEXT("Cast is performed every frame");
+                Issue.Recommendation = TEXT("Cache the cast result in BeginPlay and reuse the pointer (-10 points)");
+                Issue.Severity = EBPPerformanceSeverity::Warning;
+                Issue.NodeGuid = Node.NodeGuid.ToString();
+                Issue.Deduction = 10;
+                Issue.GraphName = Snapshot.GetGraph(Node).GraphName;
+            }
+        }
+    }
+
+    // Complete after EndWalk
+    FBPPerformanceFacts Facts;
+
+private:
+    void AddHotLoopIssues(const FBPBlueprintSnapshot& Snapshot, const FBPCostModel& CostModel, int32 EntryIndex, const FBPExecReach& Reach)
+    {
+        const FString& EntryName = Snapshot.Nodes[EntryIndex].Title;
+
+        for (const int32 NodeIndex : Reach.Order)
+        {
+            const FBPNodeSnapshot& Node = Snapshot.Nodes[NodeIndex];
+            const int32 LoopNesting = Reach.Nesting[NodeIndex];
+            const bool bIsLoop = Node.MacroIndex != INDEX_NONE && Snapshot.Macros[Node.MacroIndex]->bHasLoop;
+
+            if (bIsLoop && LoopNesting == 0)
+            {
+                // Rule 6: loop on a hot path (informational, cap at 3)
+                if (FBPPerformanceIssue* Issue = AddHotLoopIssue(Facts.HotLoopIssues, Snapshot, Reach, NodeIndex, NodeIndex))
+                {
+                    Issue->IssueType = TEXT("Loop in Hot Path");
+                    Issue->Description = FString::Printf(TEXT("'%s' runs every time '%s' fires"), *Node.FunctionName, *EntryName);
+                    Issue->Recommendation = TEXT("Keep the collection small or spread iterations across frames");
+                    Issue->Severity = EBPPerformanceSeverity::Info;
+                }
+            }
+            else if (bIsLoop)
+            {
+                // Rule 7: loop inside another loop's body (-10 each, cap at 3)
+                if (FBPPerformanceIssue* Issue = AddHotLoopIssue(Facts.NestedLoopIssues, Snapshot, Reach, NodeIndex, NodeIndex))
+                {
+                    Issue->IssueType = TEXT("Nested Loop in Hot Path");
+                    Issue->Description = FString::Printf(TEXT("'%s' is nested %d loops deep under '%s'"), *Node.FunctionName, LoopNesting + 1, *EntryName);
+                    Issue->Recommendation = TEXT("Replace the inner loop with a Map/Set lookup or precompute it outside the outer loop (-10 points)");
+                    Issue->Severity = EBPPerformanceSeverity::Warning;
+                    Issue->Deduction = 10;
+                }
+            }
+
+            if (bIsLoop)
+            {
+                // Rule 8: loop over the results of an actor query (-15 each, cap at 3)
+                const int32 QueryIndex = FindCallFeeding(Snapshot, CostModel, NodeIndex, &IsActorQuery);
+                if (QueryIndex != INDEX_NONE)
+                {
+                    if (FBPPerformanceIssue* Issue = AddHotLoopIssue(Facts.LoopOverActorsIssues, Snapshot, Reach, NodeIndex, NodeIndex))
+                    {
+                        Issue->IssueType = TEXT("Loop over Actor Query");
+                        Issue->Description = FString::Printf(TEXT("'%s' iterates the result of '%s' every time '%s' fires"),
+                            *Node.FunctionName, *Snapshot.Nodes[QueryIndex].CallFunctionName, *EntryName);
+                        Issue->Recommendation = TEXT("Keep a registered list of the actors (added on spawn, removed on destroy) instead of querying the world (-15 points)");
+                        Issue->Severity = EBPPerformanceSeverity::Critical;
+                        Issue->Deduction = 15;
+                    }
+                }
+            }
+
+            if (LoopNesting > 0)
+            {
+                // Rule 9: linear array search inside a loop body, run or read as a pure input (-10 each, cap at 3)
+                const int32 SearchIndex = Node.bIsCallFunction && IsLinearArrayOperation(Node.CallFunctionName)
+                    ? NodeIndex
+                    : FindCallFeeding(Snapshot, CostModel, NodeIndex, &IsLinearArrayOperation);
+                if (SearchIndex != INDEX_NONE)
+                {
+                    if (FBPPerformanceIssue* Issue = AddHotLoopIssue(Facts.LoopSearchIssues, Snapshot, Reach, NodeIndex, SearchIndex))
+                    {
+                        Issue->IssueType = TEXT("Array Search in Loop");
+                        Issue->Description = FString::Printf(TEXT("'%s' scans an array inside a loop %d deep under '%s', making the loop O(n^2)"),
+                            *Snapshot.Nodes[SearchIndex].CallFunctionName, LoopNesting, *EntryName);
+                        Issue->Recommendation = TEXT("Use a Set or Map for membership and removal, or build one before the loop (-10 points)");
+                        Issue->Severity = EBPPerformanceSeverity::Warning;
+                        Issue->Deduction = 10;
+                    }
+                }
+            }
+        }
+    }
+
+    TArray<int32> HotEntries;
+    TArray<int32> TickEvents;
+    TArray<int32> TickNodes;
+    TArray<int32> BeginPlayNodes;
+    TBitArray<> TickVisited;
+    TBitArray<> BeginPlayVisited;
+};
+
+class FBPPerformanceVisitor : public FBPPerformanceFactsVisitor
+{
+public:
+    explicit FBPPerformanceVisitor(FBPPerformanceReport& InReport)
+        : Report(InReport)
+    {
+    }
+
+    virtual void BeginWalk(const FBPBlueprintSnapshot& Snapshot) override
+    {
+        FBPPerformanceFactsVisitor::BeginWalk(Snapshot);
+        Report.BlueprintName = Snapshot.BlueprintName;
+        Report.AnalysisTimestamp = FDateTime::Now().ToString();
+    }
+
+    virtual void EndWalk(const FBPBlueprintSnapshot& Snapshot) override
+    {
+        FBPPerformanceFactsVisitor::EndWalk(Snapshot);
+        FBPSnapshotAnalyzer::ApplyPerformanceRules(Facts, Report);
+    }
+
+private:
+    FBPPerformanceReport& Report;
+};
+
+static void AppendCapped(TArray<FBPPerformanceIssue>& Issues, const TArray<FBPPerformanceIssue>& Other)
+{
+    for (int32 Index = 0; Index < Other.Num() && Issues.Num() < MaxTickIssuesPerRule; ++Index)
+    {
+        Issues.Add(Other[Index]);
+    }
+}
+
+// Hot loop findings are per node: two graphs whose timers run the same entry report it once, as AddHotLoopIssue does
+static void AppendCappedUnique(TArray<FBPPerformanceIssue>& Issues, const TArray<FBPPerformanceIssue>& Other)
+{
+    for (int32 Index = 0; Index < Other.Num() && Issues.Num() < MaxTickIssuesPerRule; ++Index)
+    {
+        const FString& NodeGuid = Other[Index].NodeGuid;
+        if (!Issues.ContainsByPredicate([&NodeGuid](const FBPPerformanceIssue& Issue) { return Issue.NodeGuid == NodeGuid; }))
+        {
+            Issues.Add(Other[Index]);
+        }
+    }
+}
+
+void FBPPerformanceFacts::Append(const FBPPerformanceFacts& Other)
+{
+    TotalNodes += Other.TotalNodes;
+    EventCount += Other.EventCount;
+    CastCount += Other.CastCount;
+    TickNodeCount += Other.TickNodeCount;
+    BeginPlayNodeCount += Other.BeginPlayNodeCount;
+
+    AppendCapped(TickCallIssues, Other.TickCallIssues);
+    AppendCapped(TickCastIssues, Other.TickCastIssues);
+    AppendCappedUnique(HotLoopIssues, Other.HotLoopIssues);
+    AppendCappedUnique(NestedLoopIssues, Other.NestedLoopIssues);
+    AppendCappedUnique(LoopOverActorsIssues, Other.LoopOverActorsIssues);
+    AppendCappedUnique(LoopSearchIssues, Other.LoopSearchIssues);
+    TickPathCosts.Append(Other.TickPathCosts);
+}
+
+void FBPSnapshotAnalyzer::ApplyPerformanceRules(const FBPPerformanceFacts& Facts, FBPPerformanceReport& Report)
+{
+    Report.TotalNodes = Facts.TotalNodes;
+    Report.EventCount = Facts.EventCount;
+    Report.CastCount = Facts.CastCount;
+    Report.TickNodeCount = Facts.TickNodeCount;
+    Report.BeginPlayNodeCount = Facts.BeginPlayNodeCount;
+
+    Report.TickPathCosts = Facts.TickPathCosts;
+    Report.EstimatedTickCost = 0.0f;
+    for (const FBPTickPathCost& PathCost : Report.TickPathCosts)
+    {
+        Report.EstimatedTickCost += PathCost.EstimatedCost;
+    }
+
+    Report.Issues.Reset();
+    Report.Issues.Append(Facts.TickCallIssues);
+    Report.Issues.Append(Facts.TickCastIssues);
+    Report.Issues.Append(Facts.LoopOverActorsIssues);
+    Report.Issues.Append(Facts.NestedLoopIssues);
+    Report.Issues.Append(Facts.LoopSearchIssues);
+
+    // Rule 3: Tick graph size (-15 if > 50 nodes downstream)
+    if (Report.TickNodeCount > 50)
+    {
+        FBPPerformanceIssue Issue;
+        Issue.IssueType = TEXT("Heavy Tick Logic");
+        Issue.Description = FString::Printf(TEXT("Tick event drives %d downstream nodes"), Report.TickNodeCount);
+        Issue.Recommendation = TEXT("Break Tick work across frames, move to timers, or switch to event-driven design (-15 points)");
+        Issue.Severity = EBPPerformanceSeverity::Warning;
+        Issue.Deduction = 15;
+        Report.Issues.Add(Issue);
+    }
+
+    // Rule 4: BeginPlay complexity (-10 if > 100 nodes downstream)
+    if (Report.BeginPlayNodeCount > 100)
+    {
+        FBPPerformanceIssue Issue;
+        Issue.IssueType = TEXT("Bloated BeginPlay");
+        Issue.Description = FString::Printf(TEXT("BeginPlay drives %d downstream nodes"), Report.BeginPlayNodeCount);
+        Issue.Recommendation = TEXT("Split initialization into smaller functions or defer heavy work (-10 points)");
+        Issue.Severity = EBPPerformanceSeverity::Warning;
+        Issue.Deduction = 10;
+        Report.Issues.Add(Issue);
+    }
+
+    // Rule 5: excessive total casts (-5 if > 20)
+    if (Report.CastCount > 20)
+    {
+        FBPPerformanceIssue Issue;
+        Issue.IssueType = TEXT("Excessive Casts");
+        Issue.Description = FString::Printf(TEXT("Blueprint contains %d Cast nodes"), Report.CastCount);
+        Issue.Recommendation = TEXT("Use interfaces or cached references instead of repeated Casts (-5 points)");
+        Issue.Severity = EBPPerformanceSeverity::Info;
+        Issue.Deduction = 5;
+        Report.Issues.Add(Issue);
+    }
+
+    // Rule 6 findings cost nothing, so they are listed last
+    Report.Issues.Append(Facts.HotLoopIssues);
+
+    // Final score
+    int32 Score = 100;
+    for (const FBPPerformanceIssue& Issue : Report.Issues)
+    {
+        Score -= Issue.Deduction;
+    }
+    Report.PerformanceScore = FMath::Clamp(Score, 0, 100);
+}
+
+// ============================================================
+// Phase 4: Dependency Extraction
+// ============================================================
+
+class FBPDependencyVisitor : public IBPSnapshotVisitor
+{
+public:
+    explicit FBPDependencyVisitor(TArray<FBPDependency>& InDependencies)
+        : Dependencies(InDependencies)
+    {
+    }
+
+    virtual EBPAnalyzerStage GetStage() const override { return EBPAnalyzerStage::DependencyExtraction; }
+
+    virtual bool WantsGraph(const FBPGraphSnapshot& Graph) const override
+    {
+        return Graph.Kind == EBPGraphKind::Ubergraph || Graph.Kind == EBPGraphKind::Function;
+    }
+
+    virtual void BeginGraph(const FBPBlueprintSnapshot& Snapshot, const FBPGraphSnapshot& Graph) override
+    {
+        GraphName = Graph.GraphName;
+    }
+
+    virtual void VisitNode(const FBPBlueprintSnapshot& Snapshot, int32 NodeIndex, const FBPNodeSnapshot& Node) override
+    {
+        if (Node.bIsSpawnActor)
+        {
+            for (const FBPPinSnapshot& Pin : Snapshot.GetPins(Node))
+            {
+                if (Pin.PinName == TEXT("Class") && !Pin.DefaultObjectName.IsEmpty())
+                {
+                    Add(Snapshot, Node, Pin.DefaultObjectName, TEXT("Spawn"));
+                }
+            }
+        }
+
+        if (!Node.CastTargetClass.IsEmpty())
+        {
+            Add(Snapshot, Node, Node.CastTargetClass, TEXT("Cast"));
+        }
+
+        if (!Node.CallOwnerClass.IsEmpty())
+        {
+            const FString& OwnerName = Node.CallOwnerClass;
+            if (OwnerName != Snapshot.BlueprintName &&
+                OwnerName != TEXT("Object") &&
+                OwnerName != TEXT("KismetSystemLibrary") &&
+                OwnerName != TEXT("KismetMathLibrary") &&
+                OwnerName != TEXT("KismetStringLibrary") &&
+                OwnerName != TEXT("GameplayStatics"))
+            {
+                Add(Snapshot, Node, OwnerName, TEXT("Call"));
+            }
+        }
+    }
+
+    virtual void VisitPin(const FBPBlueprintSnapshot& Snapshot, const FBPNodeSnapshot& Node, int32 PinIndex, const FBPPinSnapshot& Pin) override
+    {
+        if (Pin.Direction == EGPD_Input && !Pin.DefaultBlueprintName.IsEmpty())
+        {
+            Add(Snapshot, Node, Pin.DefaultBlueprintName, TEXT("HardRef"));
+        }
+    }
+
+private:
+    void Add(const FBPBlueprintSnapshot& Snapshot, const FBPNodeSnapshot& Node, const FString& ReferencedClass, const TCHAR* ReferenceType)
+    {
+        FBPDependency& Dep = Dependencies.AddDefaulted_GetRef();
+        Dep.ReferencingBlueprint = Snapshot.BlueprintName;
+        Dep.ReferencedClass = ReferencedClass;
+        Dep.ReferenceType = ReferenceType;
+        Dep.NodeGuid = Node.NodeGuid.ToString();
+        Dep.GraphName = GraphName;
+    }
+
+    TArray<FBPDependency>& Dependencies;
+    FString GraphName;
+};
+
+// ============================================================
+// Entry points
+// ============================================================
+
+FBlueprintAnalysisResult FBPSnapshotAnalyzer::BuildAnalysisResult(const FBPBlueprintSnapshot& Snapshot, FBPPerformanceFacts* OutPerformanceFacts,
+    const FBPTraceLimits& Limits)
+{
+    FBlueprintAnalysisResult Result;
+    if (!Snapshot.IsValid()) return Result;
+
+    FBPNodeInfoVisitor NodeInfoVisitor(Result);
+    FBPConnectionVisitor ConnectionVisitor(Result);
+    FBPPerformanceFactsVisitor PerformanceFactsVisitor;
+    if (OutPerformanceFacts)
+    {
+        IBPSnapshotVisitor* Visitors[] = { &NodeInfoVisitor, &ConnectionVisitor, &PerformanceFactsVisitor };
+        Walk(Snapshot, Visitors);
+        *OutPerformanceFacts = MoveTemp(PerformanceFactsVisitor.Facts);
+    }
+    else
+    {
+        IBPSnapshotVisitor* Visitors[] = { &NodeInfoVisitor, &ConnectionVisitor };
+        Walk(Snapshot, Visitors);
+    }
+
+    TraceExecutionPaths(Snapshot, Result.ExecutionPaths, Result.SharedSegments, Limits);
+
+    return Result;
+}
+
+FBPPerformanceReport FBPSnapshotAnalyzer::AnalyzePerformance(const FBPBlueprintSnapshot& Snapshot)
+{
+    FBPPerformanceReport Report;
+    if (!Snapshot.IsValid()) return Report;
+
+    FBPPerformanceVisitor PerformanceVisitor(Report);
+    IBPSnapshotVisitor* Visitors[] = { &PerformanceVisitor };
+    Walk(Snapshot, Visitors);
+
+    return Report;
+}
+
+TArray<FBPDependency> FBPSnapshotAnalyzer::ExtractDependencies(const FBPBlueprintSnapshot& Snapshot)
+{
+    TArray<FBPDependency> Dependencies;
+    if (!Snapshot.IsValid()) return Dependencies;
+
+    FBPDependencyVisitor DependencyVisitor(Dependencies);
+    IBPSnapshotVisitor* Visitors[] = { &DependencyVisitor };
+    Walk(Snapshot, Visitors);
+
+    return Dependencies;
+}
+
+int32 FBPSnapshotAnalyzer::CountSummaryNodes(const FBPBlueprintSnapshot& Snapshot)
+{
+    int32 NodeCount = 0;
+
+    FBPSummaryNodeCountVisitor CountVisitor(NodeCount);
+    IBPSnapshotVisitor* Visitors[] = { &CountVisitor };
+    Walk(Snapshot, Visitors);
+
+    return NodeCount;
+}
+
+FBPSnapshotAnalysis FBPSnapshotAnalyzer::AnalyzeAll(const FBPBlueprintSnapshot& Snapshot, const FBPTraceLimits& Limits)
+{
+    FBPSnapshotAnalysis Out;
+    if (!Snapshot.IsValid()) return Out;
+
+    FBPSummaryNodeCountVisitor CountVisitor(Out.SummaryNodeCount);
+    FBPPerformanceVisitor PerformanceVisitor(Out.PerformanceReport);
+    FBPDependencyVisitor DependencyVisitor(Out.Dependencies);
+
+    IBPSnapshotVisitor* Visitors[] = { &CountVisitor, &PerformanceVisitor, &DependencyVisitor };
+    Walk(Snapshot, Visitors);
+
+    // Token estimates only need the text size; measure it from the snapshot instead of
+    // building node, connection and step strings for every Blueprint in the batch
+    Out.Trace = TraceCompact(Snapshot, Limits);
+    Out.LLMTextChars = UBlueprintAnalyzerLibrary::CountSnapshotLLMTextChars(Snapshot, Out.Trace);
+
+    return Out;
+}
@@ -0,0 +1,259 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerSynthetic.h"
+#include "K2Node.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_ExecutionSequence.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "WidgetBlueprint.h"
+#include "Components/PanelWidget.h"
+#include "Components/VerticalBox.h"
+#include "Components/HorizontalBox.h"
+#include "Components/TextBlock.h"
+#include "UObject/Package.h"
+
+// Node grid used for positions, so comment boxes frame consecutive nodes
+static constexpr int32 GridColumns = 40;
+static constexpr int32 GridCellWidth = 320;
+static constexpr int32 GridCellHeight = 200;
+
+static UPackage* CreateSyntheticPackage(const FString& Name)
+{
+    UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Temp/BlueprintAnalyzer/%s"), *Name));
+    Package->SetFlags(RF_Transient);
+    return Package;
+}
+
+template<typename NodeType>
+static NodeType* SpawnNode(UEdGraph& Graph, int32 GridIndex, TFunctionRef<void(NodeType&)> Setup)
+{
+    FGraphNodeCreator<NodeType> Creator(Graph);
+    NodeType* Node = Creator.CreateNode(false);
+    Setup(*Node);
+    Node->NodePosX = (GridIndex % GridColumns) * GridCellWidth;
+    Node->NodePosY = (GridIndex / GridColumns) * GridCellHeight;
+    Creator.Finalize();
+    return Node;
+}
+
+static UFunction* FindLibraryFunction(UClass* Class, FName FunctionName)
+{
+    UFunction* Function = Class->FindFunctionByName(FunctionName);
+    check(Function);
+    return Function;
+}
+
+// Grows an execution tree of NodeCount nodes from Root; open exec outputs are filled
+// breadth first, so fan-out widens the tree instead of deepening one path
+static void PopulateGraph(UEdGraph& Graph, UEdGraphPin* Root, int32 NodeCount, const FBPSyntheticShape& Shape)
+{
+    UFunction* PrintString = FindLibraryFunction(UKismetSystemLibrary::StaticClass(), GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString));
+    UFunction* GetAllActors = FindLibraryFunction(UGameplayStatics::StaticClass(), GET_FUNCTION_NAME_CHECKED(UGameplayStatics, GetAllActorsOfClass));
+
+    TArray<UEdGraphPin*> Open;
+    Open.Add(Root);
+    int32 OpenHead = 0;
+
+    for (int32 Index = 0; Index < NodeCount; ++Index)
+    {
+        // Every node adds at least one output, so the queue never runs dry
+        UEdGraphPin* Input = Open[OpenHead++];
+        const int32 GridIndex = Index + 1;
+
+        UK2Node* Node = nullptr;
+        if (Shape.BranchEvery > 0 && Index % Shape.BranchEvery == Shape.BranchEvery - 1)
+        {
+            if ((Index / Shape.BranchEvery) % 2 == 0)
+            {
+                UK2Node_IfThenElse* Branch = SpawnNode<UK2Node_IfThenElse>(Graph, GridIndex, [](UK2Node_IfThenElse&) {});
+                Open.Add(Branch->GetThenPin());
+                Open.Add(Branch->GetElsePin());
+                Node = Branch;
+            }
+            else
+            {
+                UK2Node_ExecutionSequence* Sequence = SpawnNode<UK2Node_ExecutionSequence>(Graph, GridIndex, [](UK2Node_ExecutionSequence&) {});
+                for (int32 Output = 2; Output < Shape.FanOut; ++Output)
+                {
+                    Sequence->AddInputPin();
+                }
+                for (int32 Output = 0; Output < FMath::Max(Shape.FanOut, 2); ++Output)
+                {
+                    Open.Add(Sequence->GetThenPinGivenIndex(Output));
+                }
+                Node = Sequence;
+            }
+        }
+        else
+        {
+            // Sprinkle in a call the perf rules flag so their reporting path is exercised too
+            UFunction* Function = Index % 50 == 49 ? GetAllActors : PrintString;
+            UK2Node_CallFunction* Call = SpawnNode<UK2Node_CallFunction>(Graph, GridIndex, [Function](UK2Node_CallFunction& CallNode)
+            {
+                CallNode.SetFromFunction(Function);
+            });
+            Open.Add(Call->GetThenPin());
+            Node = Call;
+        }
+
+        Input->MakeLinkTo(Node->GetExecPin());
+    }
+
+    // Comment boxes around runs of consecutive grid cells
+    if (Shape.CommentsPer100Nodes > 0 && NodeCount > 0)
+    {
+        const int32 NumComments = FMath::Max(1, NodeCount * Shape.CommentsPer100Nodes / 100);
+        const int32 Stride = FMath::Max(1, NodeCount / NumComments);
+        const int32 Span = FMath::Clamp(Stride / 2, 1, GridColumns);
+
+        for (int32 Comment = 0; Comment < NumComments; ++Comment)
+        {
+            const int32 FirstCell = 1 + Comment * Stride;
+            SpawnNode<UEdGraphNode_Comment>(Graph, FirstCell, [Comment, Span](UEdGraphNode_Comment& CommentNode)
+            {
+                CommentNode.NodeComment = FString::Printf(TEXT("Section %d"), Comment);
+                CommentNode.NodeWidth = Span * GridCellWidth;
+                CommentNode.NodeHeight = GridCellHeight;
+            });
+        }
+    }
+}
+
+UBlueprint* FBPSyntheticBlueprints::CreateActorBlueprint(const FString& Name, const FBPSyntheticShape& Shape)
+{
+    check(IsInGameThread());
+
+    UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(AActor::StaticClass(), CreateSyntheticPackage(Name), FName(*Name),
+        BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+    if (!Blueprint) return nullptr;
+
+    const int32 NumGraphs = 1 + FMath::Max(Shape.FunctionCount, 0);
+    const int32 NodesPerGraph = FMath::Max(1, Shape.NodeCount / NumGraphs);
+
+    TArray<FName> FunctionNames;
+    for (int32 FunctionIndex = 0; FunctionIndex < NumGraphs - 1; ++FunctionIndex)
+    {
+        UEdGraph* FunctionGraph = FBlueprintEditorUtils::CreateNewGraph(Blueprint, FName(*FString::Printf(TEXT("SyntheticFunction_%d"), FunctionIndex)),
+            UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+        FBlueprintEditorUtils::AddFunctionGraph<UClass>(Blueprint, FunctionGraph, true, nullptr);
+        FunctionNames.Add(FunctionGraph->GetFName());
+
+        TArray<UK2Node_FunctionEntry*> Entries;
+        FunctionGraph->GetNodesOfClass(Entries);
+        check(Entries.Num() == 1);
+        PopulateGraph(*FunctionGraph, Entries[0]->FindPinChecked(UEdGraphSchema_K2::PN_Then), NodesPerGraph, Shape);
+    }
+
+    UEdGraph* EventGraph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
+    check(EventGraph);
+    int32 EventGraphNodes = Shape.NodeCount - NodesPerGraph * (NumGraphs - 1);
+
+    // Event graph, rooted at a custom event, or at Tick calling each function in turn
+    UEdGraphPin* Root = nullptr;
+    if (Shape.bTickCallsFunctions)
+    {
+        // Calls into the functions resolve against the skeleton class
+        FKismetEditorUtilities::GenerateBlueprintSkeleton(Blueprint, true);
+
+        const FName TickName(TEXT("ReceiveTick"));
+        UK2Node_Event* Tick = FBlueprintEditorUtils::FindOverrideForFunction(Blueprint, AActor::StaticClass(), TickName);
+        if (!Tick)
+        {
+            int32 NodePosY = 0;
+            Tick = FKismetEditorUtilities::AddDefaultEventNode(Blueprint, EventGraph, TickName, AActor::StaticClass(), NodePosY);
+        }
+        check(Tick);
+
+        Root = Tick->FindPinChecked(UEdGraphSchema_K2::PN_Then);
+        for (int32 FunctionIndex = 0; FunctionIndex < FunctionNames.Num(); ++FunctionIndex)
+        {
+            const FName FunctionName = FunctionNames[FunctionIndex];
+            UK2Node_CallFunction* Call = SpawnNode<UK2Node_CallFunction>(*EventGraph, FunctionIndex + 1, [FunctionName](UK2Node_CallFunction& CallNode)
+            {
+                CallNode.FunctionReference.SetSelfMember(FunctionName);
+            });
+            Root->MakeLinkTo(Call->GetExecPin());
+            Root = Call->GetThenPin();
+        }
+        EventGraphNodes -= FunctionNames.Num();
+    }
+    else
+    {
+        UK2Node_CustomEvent* Event = SpawnNode<UK2Node_CustomEvent>(*EventGraph, 0, [](UK2Node_CustomEvent& EventNode)
+        {
+            EventNode.CustomFunctionName = TEXT("SyntheticEntry");
+        });
+        Root = Event->FindPinChecked(UEdGraphSchema_K2::PN_Then);
+    }
+    PopulateGraph(*EventGraph, Root, FMath::Max(EventGraphNodes, 0), Shape);
+
+    return Blueprint;
+}
+
+// Nests WidgetDepth panels and spreads the remaining widgets as text leaves over all levels
+UWidgetBlueprint* FBPSyntheticBlueprints::CreateWidgetBlueprint(const FString& Name, const FBPSyntheticShape& Shape)
+{
+    check(IsInGameThread());
+
+    UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(FKismetEditorUtilities::CreateBlueprint(UUserWidget::StaticClass(), CreateSyntheticPackage(Name), FName(*Name),
+        BPTYPE_Normal, UWidgetBlueprint::StaticClass(), UWidgetBlueprintGeneratedClass::StaticClass()));
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree) return WidgetBlueprint;
+
+    UWidgetTree* Tree = WidgetBlueprint->WidgetTree;
+    const int32 Depth = FMath::Max(Shape.WidgetDepth, 1);
+
+    TArray<UPanelWidget*> Levels;
+    for (int32 Level = 0; Level < Depth; ++Level)
+    {
+        UPanelWidget* Panel = Level % 2 == 0
+            ? static_cast<UPanelWidget*>(Tree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass()))
+            : static_cast<UPanelWidget*>(Tree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass()));
+
+        if (Levels.Num() == 0)
+        {
+            Tree->RootWidget = Panel;
+        }
+        else
+        {
+            Levels.Last()->AddChild(Panel);
+        }
+        Levels.Add(Panel);
+    }
+
+    for (int32 Leaf = 0; Leaf < Shape.WidgetCount - Depth; ++Leaf)
+    {
+        UTextBlock* Text = Tree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass());
+        Text->SetText(FText::AsNumber(Leaf));
+        Levels[Leaf % Depth]->AddChild(Text);
+    }
+
+    return WidgetBlueprint;
+}
+
+void FBPSyntheticBlueprints::Discard(UBlueprint* Blueprint)
+{
+    if (!Blueprint) return;
+
+    Blueprint->ClearFlags(RF_Public | RF_Standalone);
+    if (UClass* GeneratedClass = Blueprint->GeneratedClass)
+    {
+        GeneratedClass->ClearFlags(RF_Public | RF_Standalone);
+    }
+    Blueprint->GetOutermost()->ClearFlags(RF_Public | RF_Standalone);
+}
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerBinaryFormat.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Strings equal ignoring case, so a case-insensitive string table would merge them
+static const TCHAR* const CaseVariantStrings[][2] = {
+    { TEXT("Branch"), TEXT("branch") },
+    { TEXT("EventGraph"), TEXT("EVENTGRAPH") },
+    { TEXT("0123456789ABCDEF0123456789ABCDEF"), TEXT("0123456789abcdef0123456789abcdef") },
+};
+
+static FBlueprintNodeInfo MakeNode(const TCHAR* Value)
+{
+    FBlueprintNodeInfo Node;
+    Node.NodeType = Value;
+    Node.NodeName = Value;
+    Node.FunctionName = Value;
+    Node.NodeGuid = Value;
+    Node.GraphName = Value;
+    Node.InputPins.Add(Value);
+    return Node;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBPBinaryFormatRoundTripTest, "BlueprintAnalyzer.BinaryFormat.RoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FBPBinaryFormatRoundTripTest::RunTest(const FString& Parameters)
+{
+    FBlueprintAnalysisResult Result;
+    Result.BlueprintName = TEXT("BP_CaseVariants");
+    for (const auto& Variants : CaseVariantStrings)
+    {
+        Result.Nodes.Add(MakeNode(Variants[0]));
+        Result.Nodes.Add(MakeNode(Variants[1]));
+    }
+
+    FBlueprintAnalysisResult ReadBack;
+    if (!TestTrue(TEXT("Read back what was written"), FBPBinaryFormat::Read(FBPBinaryFormat::Write(Result), ReadBack)))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Blueprint name"), ReadBack.BlueprintName, Result.BlueprintName);
+    if (!TestEqual(TEXT("Node count"), ReadBack.Nodes.Num(), Result.Nodes.Num()))
+    {
+        return false;
+    }
+
+    // FString == ignores case, so each field is compared case-sensitively
+    for (int32 NodeIndex = 0; NodeIndex < Result.Nodes.Num(); ++NodeIndex)
+    {
+        const FBlueprintNodeInfo& Expected = Result.Nodes[NodeIndex];
+        const FBlueprintNodeInfo& Actual = ReadBack.Nodes[NodeIndex];
+        const bool bSame = Actual.NodeType.Equals(Expected.NodeType, ESearchCase::CaseSensitive)
+            && Actual.NodeName.Equals(Expected.NodeName, ESearchCase::CaseSensitive)
+            && Actual.FunctionName.Equals(Expected.FunctionName, ESearchCase::CaseSensitive)
+            && Actual.NodeGuid.Equals(Expected.NodeGuid, ESearchCase::CaseSensitive)
+            && Actual.GraphName.Equals(Expected.GraphName, ESearchCase::CaseSensitive)
+            && Actual.InputPins.Num() == 1 && Actual.InputPins[0].Equals(Expected.InputPins[0], ESearchCase::CaseSensitive);
+        TestTrue(FString::Printf(TEXT("Node %d keeps the case of \"%s\""), NodeIndex, *Expected.NodeType), bSame);
+    }
+
+    return !HasAnyErrors();
+}
+
+#endif
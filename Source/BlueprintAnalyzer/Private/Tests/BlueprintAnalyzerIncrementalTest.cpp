@@ -0,0 +1,216 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerIncremental.h"
+#include "BlueprintAnalyzerMacroCache.h"
+#include "BlueprintAnalyzerSnapshot.h"
+#include "BlueprintAnalyzerSynthetic.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Tunnel.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Call depths the comparison runs at: none, and enough to expand the Tick -> function calls
+static const TArray<int32> IncrementalTestCallDepths = { 0, 2 };
+
+static UEdGraph* FindFunctionGraph(UBlueprint* Blueprint, const TCHAR* Name)
+{
+    for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+    {
+        if (Graph && Graph->GetName() == Name) return Graph;
+    }
+    return nullptr;
+}
+
+static UEdGraphPin* FindExecPin(UEdGraphNode& Node, EEdGraphPinDirection Direction)
+{
+    for (UEdGraphPin* Pin : Node.Pins)
+    {
+        if (Pin->Direction == Direction && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec) return Pin;
+    }
+    return nullptr;
+}
+
+// Runs Node right after From, ahead of whatever From led to
+static void InsertAfter(UEdGraphPin* From, UEdGraphNode& Node)
+{
+    const TArray<UEdGraphPin*> Next = From->LinkedTo;
+    From->BreakAllPinLinks();
+
+    From->MakeLinkTo(FindExecPin(Node, EGPD_Input));
+    for (UEdGraphPin* Pin : Next)
+    {
+        FindExecPin(Node, EGPD_Output)->MakeLinkTo(Pin);
+    }
+}
+
+// Puts a GetAllActorsOfClass call right after From, so the Tick cost of everything reaching it changes
+static void InsertExpensiveCall(UEdGraph& Graph, UEdGraphPin* From)
+{
+    FGraphNodeCreator<UK2Node_CallFunction> Creator(Graph);
+    UK2Node_CallFunction* Call = Creator.CreateNode(false);
+    Call->SetFromFunction(UGameplayStatics::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UGameplayStatics, GetAllActorsOfClass)));
+    Creator.Finalize();
+
+    InsertAfter(From, *Call);
+}
+
+static UEdGraphPin* GetFunctionEntryThen(UEdGraph& Graph)
+{
+    TArray<UK2Node_FunctionEntry*> Entries;
+    Graph.GetNodesOfClass(Entries);
+    check(Entries.Num() == 1);
+    return Entries[0]->FindPinChecked(UEdGraphSchema_K2::PN_Then);
+}
+
+// Entry tunnel's exec output of a macro made by AddPassThroughMacro
+static UEdGraphPin* GetMacroEntryOut(UEdGraph& MacroGraph)
+{
+    TArray<UK2Node_Tunnel*> Tunnels;
+    MacroGraph.GetNodesOfClass(Tunnels);
+    for (UK2Node_Tunnel* Tunnel : Tunnels)
+    {
+        if (Tunnel->bCanHaveOutputs) return FindExecPin(*Tunnel, EGPD_Output);
+    }
+    return nullptr;
+}
+
+// A macro whose exec input runs straight through to its exec output
+static UEdGraph* AddPassThroughMacro(UBlueprint* Blueprint)
+{
+    UEdGraph* MacroGraph = FBlueprintEditorUtils::CreateNewGraph(Blueprint, TEXT("PassThroughMacro"), UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+    FBlueprintEditorUtils::AddMacroGraph(Blueprint, MacroGraph, true, nullptr);
+
+    FEdGraphPinType ExecType;
+    ExecType.PinCategory = UEdGraphSchema_K2::PC_Exec;
+
+    UEdGraphPin* In = nullptr;
+    UEdGraphPin* Out = nullptr;
+    TArray<UK2Node_Tunnel*> Tunnels;
+    MacroGraph->GetNodesOfClass(Tunnels);
+    for (UK2Node_Tunnel* Tunnel : Tunnels)
+    {
+        if (Tunnel->bCanHaveOutputs)
+        {
+            In = Tunnel->CreateUserDefinedPin(TEXT("In"), ExecType, EGPD_Output);
+        }
+        else
+        {
+            Out = Tunnel->CreateUserDefinedPin(TEXT("Out"), ExecType, EGPD_Input);
+        }
+    }
+    check(In && Out);
+    In->MakeLinkTo(Out);
+    return MacroGraph;
+}
+
+static void InsertMacroInstance(UEdGraph& Graph, UEdGraphPin* From, UEdGraph* MacroGraph)
+{
+    FGraphNodeCreator<UK2Node_MacroInstance> Creator(Graph);
+    UK2Node_MacroInstance* Instance = Creator.CreateNode(false);
+    Instance->SetMacroGraph(MacroGraph);
+    Creator.Finalize();
+
+    InsertAfter(From, *Instance);
+}
+
+// Timestamps differ between any two runs; everything else has to match field for field
+static void TestMatchesFull(FAutomationTestBase& Test, const FString& What, UBlueprint* Blueprint, const FBPIncrementalAnalysis& Incremental)
+{
+    // Macro summaries left stale by the incremental update must not leak into the reference
+    FBPMacroCache::Get().Reset();
+    const FBPBlueprintSnapshot Snapshot = FBPSnapshotAnalyzer::Capture(Blueprint);
+
+    FBlueprintAnalysisResult FullAnalysis = FBPSnapshotAnalyzer::BuildAnalysisResult(Snapshot);
+    FBlueprintAnalysisResult IncrementalAnalysis = Incremental.GetAnalysis();
+    FullAnalysis.AnalysisTimestamp.Reset();
+    IncrementalAnalysis.AnalysisTimestamp.Reset();
+
+    FBPPerformanceReport FullReport = FBPSnapshotAnalyzer::AnalyzePerformance(Snapshot);
+    FBPPerformanceReport IncrementalReport = Incremental.GetPerformanceReport();
+    FullReport.AnalysisTimestamp.Reset();
+    IncrementalReport.AnalysisTimestamp.Reset();
+
+    Test.TestEqual(FString::Printf(TEXT("%s: execution paths"), *What), IncrementalAnalysis.ExecutionPaths.Num(), FullAnalysis.ExecutionPaths.Num());
+    Test.TestEqual(FString::Printf(TEXT("%s: estimated Tick cost"), *What), IncrementalReport.EstimatedTickCost, FullReport.EstimatedTickCost);
+    Test.TestEqual(FString::Printf(TEXT("%s: performance score"), *What), IncrementalReport.PerformanceScore, FullReport.PerformanceScore);
+    Test.TestTrue(FString::Printf(TEXT("%s: analysis matches a full analysis"), *What),
+        FBlueprintAnalysisResult::StaticStruct()->CompareScriptStruct(&IncrementalAnalysis, &FullAnalysis, PPF_None));
+    Test.TestTrue(FString::Printf(TEXT("%s: performance report matches a full analysis"), *What),
+        FBPPerformanceReport::StaticStruct()->CompareScriptStruct(&IncrementalReport, &FullReport, PPF_None));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBPIncrementalMatchesFullTest, "BlueprintAnalyzer.Incremental.MatchesFull",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FBPIncrementalMatchesFullTest::RunTest(const FString& Parameters)
+{
+    IConsoleVariable* CallDepth = IConsoleManager::Get().FindConsoleVariable(TEXT("BlueprintAnalyzer.TraceCallDepth"));
+    if (!CallDepth)
+    {
+        AddError(TEXT("BlueprintAnalyzer.TraceCallDepth is not registered"));
+        return false;
+    }
+    const int32 SavedCallDepth = CallDepth->GetInt();
+
+    for (const int32 Depth : IncrementalTestCallDepths)
+    {
+        FBPSyntheticShape Shape;
+        Shape.NodeCount = 400;
+        Shape.FunctionCount = 3;
+        Shape.bTickCallsFunctions = true;
+
+        UBlueprint* Blueprint = FBPSyntheticBlueprints::CreateActorBlueprint(FString::Printf(TEXT("IncrementalTest_%d"), Depth), Shape);
+        UEdGraph* Callee = Blueprint ? FindFunctionGraph(Blueprint, TEXT("SyntheticFunction_0")) : nullptr;
+        UEdGraph* MacroUser = Blueprint ? FindFunctionGraph(Blueprint, TEXT("SyntheticFunction_1")) : nullptr;
+        if (!Callee || !MacroUser)
+        {
+            AddError(TEXT("Failed to generate the test Blueprint"));
+            break;
+        }
+
+        // Tick calls SyntheticFunction_1, which runs through a macro of the same Blueprint
+        UEdGraph* MacroGraph = AddPassThroughMacro(Blueprint);
+        InsertMacroInstance(*MacroUser, GetFunctionEntryThen(*MacroUser), MacroGraph);
+
+        CallDepth->Set(Depth, ECVF_SetByCode);
+
+        FBPIncrementalAnalysis Incremental;
+        Incremental.Build(Blueprint);
+        TestMatchesFull(*this, FString::Printf(TEXT("Build, call depth %d"), Depth), Blueprint, Incremental);
+
+        // Only the callee is reported dirty; the event graph calling it has to follow
+        InsertExpensiveCall(*Callee, GetFunctionEntryThen(*Callee));
+        TSet<TObjectKey<UEdGraph>> DirtyGraphs;
+        DirtyGraphs.Add(Callee);
+        Incremental.Update(Blueprint, DirtyGraphs);
+        TestMatchesFull(*this, FString::Printf(TEXT("Callee edit, call depth %d"), Depth), Blueprint, Incremental);
+
+        // Only the macro is reported dirty; the function instancing it and the event graph calling that have to follow
+        InsertExpensiveCall(*MacroGraph, GetMacroEntryOut(*MacroGraph));
+        DirtyGraphs.Reset();
+        DirtyGraphs.Add(MacroGraph);
+        Incremental.Update(Blueprint, DirtyGraphs);
+        TestMatchesFull(*this, FString::Printf(TEXT("Macro body edit, call depth %d"), Depth), Blueprint, Incremental);
+
+        // A changed TraceCallDepth alone has to take effect on the next update
+        CallDepth->Set(Depth + 1, ECVF_SetByCode);
+        Incremental.Update(Blueprint, TSet<TObjectKey<UEdGraph>>());
+        TestMatchesFull(*this, FString::Printf(TEXT("Call depth changed to %d"), Depth + 1), Blueprint, Incremental);
+
+        FBPSyntheticBlueprints::Discard(Blueprint);
+    }
+
+    CallDepth->Set(SavedCallDepth, ECVF_SetByCode);
+    return !HasAnyErrors();
+}
+
+#endif
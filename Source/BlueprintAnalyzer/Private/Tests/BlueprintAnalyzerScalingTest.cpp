@@ -0,0 +1,41 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#include "BlueprintAnalyzerBenchmark.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Smaller than the commandlet's default sizes so it fits a CI run; same limits as its defaults
+static const TArray<int32> ScalingTestSizes = { 1000, 4000, 16000 };
+static constexpr int32 ScalingTestIterations = 3;
+static constexpr double ScalingTestMaxExponent = 1.3;
+static constexpr int32 ScalingTestMinFitNodes = 1000;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBPScalingTest, "BlueprintAnalyzer.Performance.Scaling",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FBPScalingTest::RunTest(const FString& Parameters)
+{
+    TArray<FBPBenchmarkSample> Samples;
+    if (!FBPBenchmark::Run(ScalingTestSizes, FBPSyntheticShape(), ScalingTestIterations, Samples))
+    {
+        AddError(TEXT("Failed to generate benchmark Blueprints"));
+        return false;
+    }
+
+    // Same columns as the commandlet's output, so CI can chart both
+    const FString CsvPath = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintAnalyzer"), TEXT("ScalingTest.csv")));
+    if (!FBPBenchmark::WriteCsv(Samples, CsvPath))
+    {
+        AddError(FString::Printf(TEXT("Failed to write %s"), *CsvPath));
+    }
+
+    for (const FString& Failure : FBPBenchmark::FindSuperlinearScaling(Samples, ScalingTestMaxExponent, ScalingTestMinFitNodes))
+    {
+        AddError(Failure);
+    }
+    return !HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,41 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintAnalyzerSynthetic.h"
+
+// Median and fastest of the timed runs of one operation at one size
+struct FBPBenchmarkSample
+{
+    FString Operation;
+    int32 NodeCount = 0;
+    double MedianSeconds = 0.0;
+    double MinSeconds = 0.0;
+};
+
+// ============================================================
+// Scaling benchmark
+// Times each analysis entry point and exporter on generated Blueprints
+// (see FBPSyntheticBlueprints) and checks that time grows close to
+// linearly with node count. Shared by the benchmark commandlet and the
+// BlueprintAnalyzer.Performance.Scaling automation test. Game thread only.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPBenchmark
+{
+public:
+    // Timings below this are dominated by timer and cache noise and are not checked for scaling
+    static constexpr double MinScalingSeconds = 0.0005;
+
+    // Samples grouped by size in ascending Sizes order, operations in the same order within each size.
+    // Returns false if a Blueprint could not be generated.
+    static bool Run(const TArray<int32>& Sizes, const FBPSyntheticShape& BaseShape, int32 Iterations, TArray<FBPBenchmarkSample>& OutSamples);
+
+    // One message per operation and pair of consecutive checked sizes (both at least MinFitNodes)
+    // where time grows faster than size^MaxExponent
+    static TArray<FString> FindSuperlinearScaling(const TArray<FBPBenchmarkSample>& Samples, double MaxExponent, int32 MinFitNodes);
+
+    // One row per sample, with the per-node median; logs where it went. False if the file could not be written.
+    static bool WriteCsv(const TArray<FBPBenchmarkSample>& Samples, const FString& FilePath);
+};
@@ -0,0 +1,34 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BlueprintAnalyzerBenchmarkCommandlet.generated.h"
+
+/**
+ * Scaling benchmark on generated Blueprints (see FBPSyntheticBlueprints):
+ *
+ *   UnrealEditor-Cmd <Project>.uproject -run=BlueprintAnalyzerBenchmark -nullrhi
+ *       -Sizes=10+100+1000+10000+50000          node counts to generate
+ *       -Iterations=<n>                         timed runs per operation, median is reported (default 3)
+ *       -Output=<file.csv>                      defaults to <Project>/Saved/BlueprintAnalyzer/Benchmark.csv
+ *       -BranchEvery=<n> -FanOut=<n> -CommentsPer100=<n> -Functions=<n> -WidgetDepth=<n>
+ *       -MaxExponent=<x>                        scaling limit, default 1.3
+ *       -MinFitNodes=<n>                        smallest size checked for scaling, default 1000
+ *
+ * Times each analysis entry point and exporter per size and writes one CSV row per
+ * (operation, size). Between consecutive checked sizes, time must grow no faster than
+ * size^MaxExponent; returns 1 if any operation scales worse, 0 otherwise. The
+ * timing and the check live in FBPBenchmark, which the automation test shares.
+ */
+UCLASS()
+class BLUEPRINTANALYZER_API UBlueprintAnalyzerBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UBlueprintAnalyzerBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
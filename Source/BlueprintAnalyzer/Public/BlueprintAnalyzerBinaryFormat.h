@@ -0,0 +1,53 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintAnalyzerLibrary.h"
+
+// ============================================================
+// Binary analysis format (.bpab)
+// Compact, versioned serialization of FBlueprintAnalysisResult and
+// FBPProjectAnalysis for results too large to keep as JSON:
+//
+//   uint32 Magic 'BPAB' | uint16 FormatVersion | uint8 Payload | uint8 Reserved
+//   string table: varint count, then per string a varint header
+//                 (byte length << 1, or 1 for a GUID stored as 16 raw bytes)
+//                 followed by the UTF-8 bytes
+//   body:         the struct fields in declaration order; strings are varint
+//                 indices into the table, integers zigzag varints, floats raw,
+//                 arrays a varint count followed by the elements
+//
+// Field keys are implied by the version, so any change to what is written
+// needs a FormatVersion bump and a reader branch for older files.
+// ============================================================
+
+enum class EBPBinaryPayload : uint8
+{
+    AnalysisResult = 1,
+    ProjectAnalysis = 2,
+};
+
+class BLUEPRINTANALYZER_API FBPBinaryFormat
+{
+public:
+    // 'BPAB'
+    static constexpr uint32 Magic = 0x42415042;
+    // 2: execution path and step truncation flags
+    // 3: shared execution segments and the step flag referencing them
+    // 4: step call depth and recursive call flag
+    // 5: summary estimated tick cost
+    static constexpr uint16 FormatVersion = 5;
+
+    static TArray<uint8> Write(const FBlueprintAnalysisResult& Result);
+    static TArray<uint8> Write(const FBPProjectAnalysis& Analysis);
+
+    // False (and a warning) on a wrong magic, payload or newer version, or truncated/corrupt data
+    static bool Read(TConstArrayView<uint8> Bytes, FBlueprintAnalysisResult& OutResult);
+    static bool Read(TConstArrayView<uint8> Bytes, FBPProjectAnalysis& OutAnalysis);
+
+    static bool SaveToFile(const FBlueprintAnalysisResult& Result, const FString& FilePath);
+    static bool SaveToFile(const FBPProjectAnalysis& Analysis, const FString& FilePath);
+    static bool LoadFromFile(const FString& FilePath, FBlueprintAnalysisResult& OutResult);
+    static bool LoadFromFile(const FString& FilePath, FBPProjectAnalysis& OutAnalysis);
+};
@@ -0,0 +1,102 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IO/IoHash.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerIndex.h"
+#include "BlueprintAnalyzerSnapshot.h"
+
+class UBlueprint;
+
+// ============================================================
+// Persistent analysis cache
+// Per-Blueprint results stored under Saved/BlueprintAnalyzer/, keyed by
+// object path and validated against the package's saved hash from the asset
+// registry. Entries are reused only when the hash, the trace limits and
+// AnalyzerVersion all match, so unchanged packages never need to be loaded
+// again. Macro libraries the Blueprint instances live in other packages;
+// their saved hashes are stored with the entry and must match as well.
+// Entries unused for 30 days are dropped when the file is written.
+// Game thread only.
+// ============================================================
+
+struct FBPPackageHash
+{
+    FName PackageName;
+    FIoHash SavedHash;
+
+    friend FArchive& operator<<(FArchive& Ar, FBPPackageHash& PackageHash)
+    {
+        return Ar << PackageHash.PackageName << PackageHash.SavedHash;
+    }
+};
+
+struct FBPAnalysisCacheEntry
+{
+    FIoHash PackageSavedHash;
+
+    // UTC ticks of the last run that stored or reused the entry
+    int64 LastUsedTicks = 0;
+
+    // Macro library packages the results depend on, at their saved hashes when analyzed
+    TArray<FBPPackageHash> MacroPackageHashes;
+
+    // Limits the paths were traced with; token counts and index rows depend on them
+    FBPTraceLimits TraceLimits;
+
+    FBPBlueprintSummary Summary;
+    FBPPerformanceReport PerformanceReport;
+    TArray<FBPDependency> Dependencies;
+    FBPIndexRows IndexRows;
+};
+
+class BLUEPRINTANALYZER_API FBPAnalysisCache
+{
+public:
+    // Bump whenever summary, perf rules, dependency extraction, token counting or index rows change output
+    static constexpr uint32 AnalyzerVersion = 14;
+
+    static FBPAnalysisCache& Get();
+
+    // Saved hash of the package on disk; zero when unknown (never saved, or registry lacks package data)
+    static FIoHash GetPackageSavedHash(FName PackageName);
+
+    // Saved hashes of Packages; false when one has unsaved edits or no saved hash, in which case
+    // results depending on it must not be cached
+    static bool GetPackageSavedHashes(const TArray<FName>& Packages, TArray<FBPPackageHash>& OutHashes);
+
+    // Cached entry for a Blueprint whose package on disk still hashes to SavedHash, whose macro
+    // libraries are unchanged and that was traced with Limits, nullptr otherwise
+    const FBPAnalysisCacheEntry* Find(const FString& ObjectPath, const FIoHash& SavedHash, const FBPTraceLimits& Limits);
+
+    // Cached entry for an already loaded Blueprint under the current trace limits; misses when the
+    // package has unsaved edits
+    const FBPAnalysisCacheEntry* FindForBlueprint(UBlueprint* Blueprint);
+
+    void Store(const FString& ObjectPath, FBPAnalysisCacheEntry&& Entry);
+
+    // Writes the cache file if anything changed since the last load/save
+    void Save();
+
+    void Clear();
+
+    int32 GetNumHits() const { return NumHits; }
+    int32 GetNumMisses() const { return NumMisses; }
+
+private:
+    FBPAnalysisCache() = default;
+
+    void LoadIfNeeded();
+
+    // Every package still hashes as recorded and none has unsaved edits in memory
+    static bool AreSavedHashesCurrent(const TArray<FBPPackageHash>& PackageHashes);
+    static FString GetCacheFilePath();
+
+    TMap<FString, FBPAnalysisCacheEntry> Entries;
+    bool bLoaded = false;
+    bool bDirty = false;
+    int32 NumHits = 0;
+    int32 NumMisses = 0;
+};
@@ -0,0 +1,36 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BlueprintAnalyzerCommandlet.generated.h"
+
+/**
+ * Headless project analysis for build agents, no editor UI or RHI required:
+ *
+ *   UnrealEditor-Cmd <Project>.uproject -run=BlueprintAnalyzer -nullrhi
+ *       -Folders=/Game/Blueprints+/Game/UI     folders to analyze recursively ('+' or ',' separated)
+ *       -Packages=/Game/Core/BP_GameMode       individual Blueprint packages
+ *       -OutputDir=<dir>                        defaults to <Project>/Saved/BlueprintAnalyzer
+ *       -Format=JSON|TEXT|BINARY|ALL            defaults to JSON
+ *       -Workers=<n>                            0 = task graph worker count
+ *       -ChunkSize=<n>                          garbage collect loaded packages every n Blueprints
+ *       -MemoryCeilingMB=<mb>                   also end a chunk once physical memory passes this
+ *       -Prefetch=<n>                           Blueprints loaded asynchronously ahead (0 = synchronous loads)
+ *       -Index[=<file.bpidx>]                   also write the project index; relative to OutputDir, default ProjectIndex.bpidx
+ *       -Profile                                log per-stage time and memory; adds StageTimings to the JSON
+ *       -NoCache  -QuickScan
+ *
+ * Returns 0 on success, 1 on bad arguments or when an output file cannot be written.
+ */
+UCLASS()
+class BLUEPRINTANALYZER_API UBlueprintAnalyzerCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UBlueprintAnalyzerCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
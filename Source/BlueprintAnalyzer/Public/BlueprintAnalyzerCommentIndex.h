@@ -0,0 +1,62 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+struct FBPCommentBox
+{
+    float Left = 0.f;
+    float Top = 0.f;
+    float Right = 0.f;
+    float Bottom = 0.f;
+    FString Text;
+
+    float GetArea() const { return (Right - Left) * (Bottom - Top); }
+
+    bool Contains(float InLeft, float InTop, float InRight, float InBottom) const
+    {
+        return InLeft >= Left && InRight <= Right && InTop >= Top && InBottom <= Bottom;
+    }
+};
+
+// ============================================================
+// Per-graph comment lookup
+// Comment boxes are bucketed into a uniform 2D grid once per graph; a
+// containment query only checks the boxes registered in the cell under
+// the node's top-left corner. When comments nest, the innermost
+// (smallest) containing box wins.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPCommentIndex
+{
+public:
+    FBPCommentIndex() = default;
+    explicit FBPCommentIndex(TArray<FBPCommentBox> InComments);
+
+    // Index over every UEdGraphNode_Comment in Graph (game thread)
+    static FBPCommentIndex ForGraph(const UEdGraph* Graph);
+
+    // Innermost comment box fully containing the rectangle, INDEX_NONE if none does
+    int32 FindInnermost(float Left, float Top, float Right, float Bottom) const;
+
+    // Comment text of the innermost box around Node, empty if the node is not inside a comment
+    FString FindCommentGroup(const UEdGraphNode* Node) const;
+
+    int32 Num() const { return Comments.Num(); }
+    const FBPCommentBox& GetComment(int32 Index) const { return Comments[Index]; }
+
+private:
+    uint64 CellKey(int32 CellX, int32 CellY) const { return (uint64(uint32(CellX)) << 32) | uint64(uint32(CellY)); }
+    int32 CellCoord(float Value) const { return FMath::FloorToInt(Value / CellSize); }
+
+    TArray<FBPCommentBox> Comments;
+    float CellSize = 1024.f;
+    TMap<uint64, TArray<int32>> Cells;
+
+    // Boxes spanning too many cells to bucket; checked on every query
+    TArray<int32> Oversized;
+};
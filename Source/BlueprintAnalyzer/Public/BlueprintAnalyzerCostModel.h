@@ -0,0 +1,78 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintAnalyzerSnapshot.h"
+
+// ============================================================
+// Static per-frame cost model
+// Estimates the Blueprint VM work of one run of an exec path, in
+// abstract units (1 = one plain node). Every executed node weighs by
+// its kind or by the function it calls, plus the pure nodes feeding
+// its inputs, which the VM evaluates again each time the node runs.
+// Nodes behind a loop macro's per-iteration output are multiplied by
+// AssumedLoopIterations per enclosing loop. Calls into the Blueprint's
+// own functions and collapsed graphs add their body's cost when the
+// callee was captured in the same snapshot.
+// Units are for ranking paths and Blueprints against each other; they
+// do not predict milliseconds. Thread-safe: reads captured data only.
+// ============================================================
+
+// Exec reach from an entry: nodes in reach order, the deepest loop nesting each is reached at,
+// and the node it was last reached from (INDEX_NONE for the entry)
+struct FBPExecReach
+{
+    TArray<int32> Order;
+    TMap<int32, int32> Nesting;
+    TMap<int32, int32> Parent;
+};
+
+class BLUEPRINTANALYZER_API FBPCostModel
+{
+public:
+    static constexpr float AssumedLoopIterations = 10.0f;
+
+    // Deeper loops are costed as this deep, so one nested loop cannot dwarf everything else
+    static constexpr int32 MaxLoopNesting = 4;
+
+    // Nodes kept in FBPTickPathCost::CostBreakdown
+    static constexpr int32 MaxBreakdownNodes = 10;
+
+    explicit FBPCostModel(const FBPBlueprintSnapshot& InSnapshot);
+
+    // Cost of one run from EntryNode (an event), with its costliest nodes
+    FBPTickPathCost EstimatePath(int32 EntryNode);
+
+    // One execution of Node by itself: no pure inputs, no callee body
+    static float GetNodeWeight(const FBPBlueprintSnapshot& Snapshot, const FBPNodeSnapshot& Node);
+
+    // Matched against known engine functions by substring, like the perf rules; 2 for anything else
+    static float GetFunctionWeight(const FString& FunctionName);
+
+    // No exec pins: evaluated on demand, each time a node reading it runs
+    bool IsPureNode(int32 NodeIndex) const { return IsPure[NodeIndex]; }
+
+    // Walks the exec flow from EntryNode. With bIntoCallees, a call into a captured function or
+    // collapsed graph continues into its body at the call's nesting, ahead of the flow after the call.
+    void Reach(int32 EntryNode, bool bIntoCallees, FBPExecReach& Out) const;
+
+private:
+
+    // One execution of NodeIndex with its pure inputs and callee body, before the loop multiplier
+    float GetExecutedCost(int32 NodeIndex);
+
+    float GetPureInputCost(int32 NodeIndex);
+
+    // Cost of one run of the graph entered at EntryNode; zero while that body is being costed
+    float GetBodyCost(int32 EntryNode);
+
+    static float GetLoopMultiplier(int32 LoopNesting);
+
+    const FBPBlueprintSnapshot& Snapshot;
+
+    TBitArray<> IsPure;
+
+    TMap<int32, float> BodyCosts;
+    TSet<int32> BodiesInProgress;
+};
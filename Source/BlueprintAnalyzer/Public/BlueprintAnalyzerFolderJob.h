@@ -0,0 +1,74 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "BlueprintAnalyzerLibrary.h"
+
+class FBPAnalysisPipeline;
+class SNotificationItem;
+
+// ============================================================
+// Background folder analysis
+// Drives FBPAnalysisPipeline from the core ticker a few milliseconds per
+// frame, so the editor stays usable while a large folder is analyzed.
+// Loads and snapshot capture still happen on the game thread; the graph
+// analysis itself runs on the task graph as in AnalyzeFolderWithOptions.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPFolderAnalysisJob : public TSharedFromThis<FBPFolderAnalysisJob>
+{
+public:
+    // Fires on the game thread as each Blueprint's summary becomes available
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnAssetAnalyzed, const FBPBlueprintSummary& /*Summary*/);
+
+    // Fires once with the merged result; when cancelled it covers the Blueprints completed so far
+    DECLARE_MULTICAST_DELEGATE_TwoParams(FOnFinished, const FBPProjectAnalysis& /*Analysis*/, bool /*bCancelled*/);
+
+    ~FBPFolderAnalysisJob();
+
+    // Starts analyzing FolderPath on the next editor tick. The job keeps itself alive until it finishes,
+    // so callers may bind the delegates and drop the returned reference. Quick scan options are ignored;
+    // use QuickScanFolder for registry-only results.
+    static TSharedRef<FBPFolderAnalysisJob> Start(const FString& FolderPath, const FBPFolderAnalysisOptions& Options = FBPFolderAnalysisOptions());
+
+    // Stops dispatching new Blueprints; the job finishes on its next tick with a partial result
+    void Cancel();
+
+    bool IsRunning() const { return bRunning; }
+    const FString& GetFolderPath() const { return FolderPath; }
+    int32 GetNumAssets() const;
+    int32 GetNumCompleted() const;
+
+    // Seconds left at the average rate so far; negative until the first Blueprint completes
+    double GetEstimatedSecondsRemaining() const;
+
+    FOnAssetAnalyzed& OnAssetAnalyzed() { return AssetAnalyzedEvent; }
+    FOnFinished& OnFinished() { return FinishedEvent; }
+
+private:
+    FBPFolderAnalysisJob() = default;
+
+    bool Tick(float DeltaTime);
+    void Complete(bool bCancelled);
+
+    void ShowNotification();
+    void UpdateNotification();
+
+    FString FolderPath;
+    TUniquePtr<FBPAnalysisPipeline> Pipeline;
+    double StartTime = 0.0;
+    double LastNotificationTime = 0.0;
+    bool bRunning = false;
+    bool bCancelRequested = false;
+
+    // Held while running so fire-and-forget callers do not destroy the job mid-analysis
+    TSharedPtr<FBPFolderAnalysisJob> SelfReference;
+
+    FTSTicker::FDelegateHandle TickHandle;
+    TSharedPtr<SNotificationItem> Notification;
+
+    FOnAssetAnalyzed AssetAnalyzedEvent;
+    FOnFinished FinishedEvent;
+};
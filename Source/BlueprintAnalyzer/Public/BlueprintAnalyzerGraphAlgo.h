@@ -0,0 +1,32 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ============================================================
+// Graph algorithms over integer vertex IDs
+// Graphs are in CSR form: the out-edges of vertex V are
+// Targets[Offsets[V] .. Offsets[V + 1]), so Offsets has NumVertices + 1 entries.
+// All algorithms are iterative; deep graphs cannot overflow the stack.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPGraphAlgo
+{
+public:
+    // Tarjan's algorithm, O(V + E). Each component's members are sorted by vertex ID and
+    // components are ordered by their smallest member, so output does not depend on DFS order.
+    // OutComponentOf (optional) receives the component index of every vertex.
+    static TArray<TArray<int32>> FindStronglyConnectedComponents(
+        TConstArrayView<int32> Offsets,
+        TConstArrayView<int32> Targets,
+        TArray<int32>* OutComponentOf = nullptr);
+
+    // Shortest cycle through Start that never leaves Start's component (BFS, linear in the
+    // component's size). Returns the vertices in order, without repeating Start; empty if none.
+    static TArray<int32> FindCycleThrough(
+        TConstArrayView<int32> Offsets,
+        TConstArrayView<int32> Targets,
+        TConstArrayView<int32> ComponentOf,
+        int32 Start);
+};
@@ -0,0 +1,85 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerSnapshot.h"
+
+class UBlueprint;
+class UEdGraph;
+
+// ============================================================
+// Incremental analysis
+// One Blueprint's analysis result and performance report, kept split by
+// graph so an edit re-extracts only the graphs it touched. Nodes,
+// connections, execution paths and shared segments of a re-extracted graph
+// are spliced into the result in place, and the perf rules are re-applied
+// over the per-graph facts. Pins link and exec flow runs only within a
+// graph; what crosses graphs (callee bodies in Tick costs, hot loop rules
+// and call expansion, looping timer targets) comes from capturing each
+// graph together with the graphs it reaches (see CaptureGraphInContext),
+// and an edit to one of those re-extracts the graph too. An edit to one of
+// the Blueprint's own macros re-extracts every graph instancing its macros;
+// macro libraries are tracked by the session cache. The result matches
+// a full AnalyzeBlueprint / AnalyzeBlueprintPerformance.
+// Game thread only.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPIncrementalAnalysis
+{
+public:
+    // Full analysis, one capture per graph, traced with the current BlueprintAnalyzer.Trace* limits
+    void Build(UBlueprint* Blueprint);
+
+    // Re-extracts DirtyGraphs, plus any graph whose node count changed without a
+    // notification and the graphs that reach those, and refreshes metadata and the
+    // perf rules. Falls back to Build when graphs were added, removed or reordered,
+    // or when the trace limits changed. Returns the graphs re-extracted.
+    int32 Update(UBlueprint* Blueprint, const TSet<TObjectKey<UEdGraph>>& DirtyGraphs);
+
+    bool IsBuilt() const { return !Analysis.BlueprintName.IsEmpty(); }
+    int32 GetNumGraphs() const { return Slices.Num(); }
+
+    const FBlueprintAnalysisResult& GetAnalysis() const { return Analysis; }
+    const FBPPerformanceReport& GetPerformanceReport() const { return PerformanceReport; }
+
+    // Limits the current result was traced with
+    const FBPTraceLimits& GetTraceLimits() const { return TraceLimits; }
+
+    // Every analyzed graph in FBPSnapshotAnalyzer::Capture order
+    static void GatherGraphs(UBlueprint* Blueprint, TArray<TPair<UEdGraph*, EBPGraphKind>>& OutGraphs);
+
+private:
+    // One graph's share of Analysis; its rows start where the previous slice's end
+    struct FGraphSlice
+    {
+        TObjectKey<UEdGraph> Graph;
+        EBPGraphKind Kind = EBPGraphKind::Ubergraph;
+
+        // Graph->Nodes.Num() when extracted; catches edits that sent no notification
+        int32 TotalNodeCount = 0;
+
+        int32 NumNodes = 0;
+        int32 NumConnections = 0;
+        int32 NumPaths = 0;
+        int32 NumSegments = 0;
+        FBPPerformanceFacts PerformanceFacts;
+
+        // Callees and timer targets captured alongside the graph; a change to any of them re-extracts it
+        TArray<TObjectKey<UEdGraph>> ContextGraphs;
+
+        // Packages of the macros instanced in the graph and its context graphs
+        TArray<FName> MacroPackages;
+    };
+
+    void ExtractSlice(UBlueprint* Blueprint, const TArray<TPair<UEdGraph*, EBPGraphKind>>& Graphs, UEdGraph* Graph, FGraphSlice& Slice,
+        int32 FirstNode, int32 FirstConnection, int32 FirstPath, int32 FirstSegment);
+    void Finalize(UBlueprint* Blueprint);
+
+    TArray<FGraphSlice> Slices;
+    FBPTraceLimits TraceLimits;
+    FBlueprintAnalysisResult Analysis;
+    FBPPerformanceReport PerformanceReport;
+};
@@ -0,0 +1,141 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerStringKeyFuncs.h"
+
+struct FBPBlueprintSnapshot;
+struct FBPTraceSet;
+
+// ============================================================
+// Project index (.bpidx)
+// Columnar, memory-mappable file written by folder analysis for queries
+// outside the editor (Tools/BlueprintIndexQuery reads it without Unreal).
+// All values are little-endian; every section starts 8-byte aligned.
+//
+//   FBPIndexHeader
+//   Blueprints      FBPIndexBlueprintRecord[NumBlueprints]
+//   Node columns    NodeType, NodeName, NodeGraph (uint32 string ids), NodeFlags (uint8)
+//   Reach columns   ReachNode, ReachEntry (uint32 node rows): node executes under entry
+//   Dependency cols DepClass, DepType, DepGraph (uint32 string ids)
+//   Strings         StringOffsets uint32[NumStrings + 1] into StringData (UTF-8, NUL
+//                   terminated), sorted bytewise so readers can binary search
+//
+// Node, reach and dependency rows of one Blueprint are contiguous; the record
+// holds the first row and count of each. NodeName is the called function,
+// cast target or macro for those nodes and the title for everything else.
+// Any layout change needs a Version bump here and in the reader.
+// ============================================================
+
+enum class EBPIndexSection : uint8
+{
+    Blueprints,
+    NodeType,
+    NodeName,
+    NodeGraph,
+    NodeFlags,
+    ReachNode,
+    ReachEntry,
+    DepClass,
+    DepType,
+    DepGraph,
+    StringOffsets,
+    StringData,
+
+    Num
+};
+
+enum EBPIndexNodeFlags : uint8
+{
+    BPIndexNode_Event = 1 << 0,
+    BPIndexNode_FunctionEntry = 1 << 1,
+    BPIndexNode_Tick = 1 << 2,
+    BPIndexNode_BeginPlay = 1 << 3,
+    BPIndexNode_Latent = 1 << 4,
+};
+
+struct FBPIndexHeader
+{
+    // 'BPIX'
+    static constexpr uint32 MagicValue = 0x58495042;
+    // 2: strings that differ only in case are no longer merged
+    static constexpr uint32 CurrentVersion = 2;
+
+    uint32 Magic = MagicValue;
+    uint32 Version = CurrentVersion;
+    uint32 NumBlueprints = 0;
+    uint32 NumNodes = 0;
+    uint32 NumReach = 0;
+    uint32 NumDependencies = 0;
+    uint32 NumStrings = 0;
+    uint32 Reserved = 0;
+    uint64 SectionOffsets[(int32)EBPIndexSection::Num] = {};
+    uint64 FileSize = 0;
+};
+static_assert(sizeof(FBPIndexHeader) == 136, "FBPIndexHeader layout is part of the file format");
+
+struct FBPIndexBlueprintRecord
+{
+    uint32 Path = 0;
+    uint32 Name = 0;
+    uint32 Type = 0;
+    uint32 ParentClass = 0;
+    uint32 FirstNode = 0;
+    uint32 NumNodes = 0;
+    uint32 FirstReach = 0;
+    uint32 NumReach = 0;
+    uint32 FirstDependency = 0;
+    uint32 NumDependencies = 0;
+    int32 PerformanceScore = 0;
+    int32 EstimatedTokenCount = 0;
+};
+static_assert(sizeof(FBPIndexBlueprintRecord) == 48, "FBPIndexBlueprintRecord layout is part of the file format");
+
+// One Blueprint's index rows with its own string table; produced next to the
+// summary on any thread, cached with it, and merged by FBPProjectIndexWriter
+struct FBPIndexRows
+{
+    TArray<FString> Strings;
+
+    TArray<uint32> NodeType;
+    TArray<uint32> NodeName;
+    TArray<uint32> NodeGraph;
+    TArray<uint8> NodeFlags;
+
+    // Local node indices
+    TArray<uint32> ReachNode;
+    TArray<uint32> ReachEntry;
+
+    static FBPIndexRows FromSnapshot(const FBPBlueprintSnapshot& Snapshot, const FBPTraceSet& Trace);
+
+    friend FArchive& operator<<(FArchive& Ar, FBPIndexRows& Rows);
+};
+
+class BLUEPRINTANALYZER_API FBPProjectIndexWriter
+{
+public:
+    void AddBlueprint(const FBPBlueprintSummary& Summary, const FBPIndexRows& Rows, const TArray<FBPDependency>& Dependencies);
+
+    bool Save(const FString& FilePath);
+
+    int32 GetNumBlueprints() const { return Blueprints.Num(); }
+
+private:
+    uint32 InternString(const FString& Value);
+
+    TMap<FString, uint32, FDefaultSetAllocator, TBPCaseSensitiveKeyFuncs<uint32>> StringIds;
+    TArray<FString> Strings;
+
+    TArray<FBPIndexBlueprintRecord> Blueprints;
+    TArray<uint32> NodeType;
+    TArray<uint32> NodeName;
+    TArray<uint32> NodeGraph;
+    TArray<uint8> NodeFlags;
+    TArray<uint32> ReachNode;
+    TArray<uint32> ReachEntry;
+    TArray<uint32> DepClass;
+    TArray<uint32> DepType;
+    TArray<uint32> DepGraph;
+};
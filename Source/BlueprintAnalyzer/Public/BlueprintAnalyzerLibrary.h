@@ -290,11 +290,31 @@ struct BLUEPRINTANALYZER_API FExecutionStep
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     bool bIsLatent;
 
+    // Trace limit reached: the node was not traced (also a terminator)
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    bool bIsTruncated;
+
+    // The flow continues in the SharedSegments path whose EntryNodeGuid is NodeGuid (also a terminator)
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    bool bIsSharedSegment;
+
+    // Expanded calls into the Blueprint's own functions / collapsed graphs enclosing this step (BlueprintAnalyzer.TraceCallDepth)
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 CallDepth;
+
+    // Calls a function or collapsed graph already expanded around this step, so it was not expanded again
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    bool bIsRecursiveCall;
+
     FExecutionStep()
     {
         Depth = 0;
         bIsTerminator = false;
         bIsLatent = false;
+        bIsTruncated = false;
+        bIsSharedSegment = false;
+        CallDepth = 0;
+        bIsRecursiveCall = false;
     }
 };
 
@@ -315,8 +335,13 @@ struct BLUEPRINTANALYZER_API FExecutionPath
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     TArray<FExecutionStep> Steps;
 
+    // Some steps are truncation markers (BlueprintAnalyzer.TraceMaxDepth / TraceMaxSteps)
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    bool bTruncated;
+
     FExecutionPath()
     {
+        bTruncated = false;
     }
 };
 
@@ -340,6 +365,10 @@ struct BLUEPRINTANALYZER_API FBlueprintAnalysisResult
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     TArray<FExecutionPath> ExecutionPaths;
 
+    // Flow reached from more than one entry, traced once; EntryNodeGuid is the segment's first node
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FExecutionPath> SharedSegments;
+
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     FString AnalysisTimestamp;
 
@@ -388,6 +417,10 @@ struct BLUEPRINTANALYZER_API FBPPerformanceIssue
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     int32 Deduction;
 
+    // Exec steps from the Tick or timer entry to the node, for findings on hot paths
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FString> EntryPath;
+
     FBPPerformanceIssue()
     {
         Severity = EBPPerformanceSeverity::Info;
@@ -395,6 +428,96 @@ struct BLUEPRINTANALYZER_API FBPPerformanceIssue
     }
 };
 
+// Time spent in one analyzer stage; filled only while profiling is enabled (BlueprintAnalyzer.Profile)
+USTRUCT(BlueprintType)
+struct BLUEPRINTANALYZER_API FBPStageTiming
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    FString Stage;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 Calls;
+
+    // Exclusive wall time: nested stages are not counted in their parent
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    float WallSeconds;
+
+    // Highest process physical memory use sampled at the end of this stage during the run, in bytes
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int64 PeakUsedPhysicalBytes;
+
+    FBPStageTiming()
+    {
+        Calls = 0;
+        WallSeconds = 0.0f;
+        PeakUsedPhysicalBytes = 0;
+    }
+};
+
+// Estimated cost of one node on a Tick path, in cost model units (see FBPCostModel)
+USTRUCT(BlueprintType)
+struct BLUEPRINTANALYZER_API FBPNodeCost
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    FString NodeGuid;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    FString Summary;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    FString GraphName;
+
+    // Per tick: the node, its pure inputs and any callee body, times its loop multiplier
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    float Cost;
+
+    // Loop bodies enclosing the node on this path
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 LoopNesting;
+
+    FBPNodeCost()
+    {
+        Cost = 0.0f;
+        LoopNesting = 0;
+    }
+};
+
+// Estimated cost of everything one Tick event runs per frame
+USTRUCT(BlueprintType)
+struct BLUEPRINTANALYZER_API FBPTickPathCost
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    FString EntryPointName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    FString EntryNodeGuid;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    FString GraphName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    float EstimatedCost;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 MaxLoopNesting;
+
+    // Costliest nodes first; only the top few are kept, EstimatedCost covers all of them
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FBPNodeCost> CostBreakdown;
+
+    FBPTickPathCost()
+    {
+        EstimatedCost = 0.0f;
+        MaxLoopNesting = 0;
+    }
+};
+
 USTRUCT(BlueprintType)
 struct BLUEPRINTANALYZER_API FBPPerformanceReport
 {
@@ -421,12 +544,22 @@ struct BLUEPRINTANALYZER_API FBPPerformanceReport
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     int32 BeginPlayNodeCount;
 
+    // Sum of TickPathCosts: estimated Blueprint VM work per frame, in cost model units
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    float EstimatedTickCost;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FBPTickPathCost> TickPathCosts;
+
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     TArray<FBPPerformanceIssue> Issues;
 
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     int32 PerformanceScore;
 
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FBPStageTiming> StageTimings;
+
     FBPPerformanceReport()
     {
         TotalNodes = 0;
@@ -434,6 +567,7 @@ struct BLUEPRINTANALYZER_API FBPPerformanceReport
         CastCount = 0;
         TickNodeCount = 0;
         BeginPlayNodeCount = 0;
+        EstimatedTickCost = 0.0f;
         PerformanceScore = 100;
     }
 };
@@ -467,6 +601,25 @@ struct BLUEPRINTANALYZER_API FBPDependency
     }
 };
 
+// One strongly connected component of the dependency graph (size >= 2)
+USTRUCT(BlueprintType)
+struct BLUEPRINTANALYZER_API FBPDependencyCycle
+{
+    GENERATED_BODY()
+
+    // Every Blueprint/class in the component, in first-seen order
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FString> Members;
+
+    // Shortest cycle through the first member, e.g. [A, B, C] for A -> B -> C -> A
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FString> RepresentativeCycle;
+
+    FBPDependencyCycle()
+    {
+    }
+};
+
 USTRUCT(BlueprintType)
 struct BLUEPRINTANALYZER_API FBPBlueprintSummary
 {
@@ -493,12 +646,45 @@ struct BLUEPRINTANALYZER_API FBPBlueprintSummary
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     int32 EstimatedTokenCount;
 
+    // FBPPerformanceReport::EstimatedTickCost; ranks Blueprints by expected frame-time impact
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    float EstimatedTickCost;
+
+    // Filled from asset registry tags / package data; available in quick scans too
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    FString ParentClass;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FString> ImplementedInterfaces;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int64 PackageDiskSize;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 HardDependencyCount;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 SoftDependencyCount;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 ReferencerCount;
+
+    // True when produced by a quick scan: graph-derived fields (nodes, score, tokens) were not computed
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    bool bQuickScan;
+
     FBPBlueprintSummary()
     {
         NodeCount = 0;
         PerformanceScore = 100;
         CriticalIssues = 0;
         EstimatedTokenCount = 0;
+        EstimatedTickCost = 0.0f;
+        PackageDiskSize = 0;
+        HardDependencyCount = 0;
+        SoftDependencyCount = 0;
+        ReferencerCount = 0;
+        bQuickScan = false;
     }
 };
 
@@ -528,14 +714,100 @@ struct BLUEPRINTANALYZER_API FBPProjectAnalysis
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     TArray<FBPDependency> Dependencies;
 
+    // One "A -> B -> A" chain per cycle in DependencyCycles
     UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
     TArray<FString> CircularDependencyChains;
 
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FBPDependencyCycle> DependencyCycles;
+
+    // Registry-only result; dependencies are package-level and scores are not computed
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    bool bQuickScan;
+
+    // Highest process physical memory use observed during the run, in bytes
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int64 PeakWorkingSetBytes;
+
+    // Garbage collections run between chunks to release loaded packages
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 ChunkCollections;
+
+    // Packages requested through async loading ahead of analysis
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 PrefetchedPackages;
+
+    // Blueprints whose package was not loaded yet when the pipeline reached them
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    int32 LoadStalls;
+
+    // Game thread time spent blocked on package loads, in seconds
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    float LoadStallSeconds;
+
+    UPROPERTY(BlueprintReadOnly, Category = "BlueprintAnalyzer")
+    TArray<FBPStageTiming> StageTimings;
+
     FBPProjectAnalysis()
     {
+        bQuickScan = false;
         BlueprintsAnalyzed = 0;
         TotalNodes = 0;
         AveragePerformanceScore = 100.0f;
+        PeakWorkingSetBytes = 0;
+        ChunkCollections = 0;
+        PrefetchedPackages = 0;
+        LoadStalls = 0;
+        LoadStallSeconds = 0.0f;
+    }
+};
+
+USTRUCT(BlueprintType)
+struct BLUEPRINTANALYZER_API FBPFolderAnalysisOptions
+{
+    GENERATED_BODY()
+
+    // Run per-Blueprint extraction on the task graph while the game thread loads the next asset
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BlueprintAnalyzer")
+    bool bParallel;
+
+    // Blueprints analyzed concurrently; 0 = one per task graph worker thread
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BlueprintAnalyzer")
+    int32 WorkerCount;
+
+    // Reuse results from Saved/BlueprintAnalyzer/ for packages whose saved hash is unchanged
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BlueprintAnalyzer")
+    bool bUseCache;
+
+    // Summarize from asset registry tags and package dependency data only; no package is loaded
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BlueprintAnalyzer")
+    bool bQuickScan;
+
+    // Release loaded packages and collect garbage after this many Blueprints are loaded; 0 = never
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BlueprintAnalyzer")
+    int32 ChunkSize;
+
+    // End the current chunk early once process physical memory exceeds this many MB; 0 = no ceiling
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BlueprintAnalyzer")
+    int32 MemoryCeilingMB;
+
+    // Upcoming Blueprints kept loading asynchronously while the current one is analyzed; 0 = load synchronously
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BlueprintAnalyzer")
+    int32 PrefetchWindow;
+
+    // Also write a memory-mappable project index (.bpidx) to this file for Tools/BlueprintIndexQuery; empty = none
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BlueprintAnalyzer")
+    FString IndexFilePath;
+
+    FBPFolderAnalysisOptions()
+    {
+        bParallel = true;
+        WorkerCount = 0;
+        bUseCache = true;
+        bQuickScan = false;
+        ChunkSize = 0;
+        MemoryCeilingMB = 0;
+        PrefetchWindow = 4;
     }
 };
 
@@ -671,9 +943,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static FString ExportToLLMText(const FBlueprintAnalysisResult& AnalysisResult);
 
+    // Format is JSON, TEXT or BINARY (compact .bpab, see FBPBinaryFormat)
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static bool SaveAnalysisToFile(const FBlueprintAnalysisResult& AnalysisResult, const FString& FilePath, const FString& Format = TEXT("JSON"));
 
+    // Reads a file written with Format BINARY; false if it is missing, corrupt or from a newer version
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static bool LoadAnalysisFromFile(const FString& FilePath, FBlueprintAnalysisResult& OutAnalysisResult);
+
     // Phase 3: Blueprint Performance Analysis Functions
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static FBPPerformanceReport AnalyzeBlueprintPerformance(UBlueprint* Blueprint);
@@ -684,22 +961,52 @@ public:
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static FString ExportPerformanceReportToLLMText(const FBPPerformanceReport& Report);
 
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static bool SavePerformanceReportToFile(const FBPPerformanceReport& Report, const FString& FilePath, const FString& Format = TEXT("JSON"));
+
     // Phase 4: Project Dependency Analysis
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static FBPProjectAnalysis AnalyzeFolder(const FString& FolderPath);
 
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static FBPProjectAnalysis AnalyzeFolderWithOptions(const FString& FolderPath, const FBPFolderAnalysisOptions& Options);
+
+    // Registry-only triage of a folder; load individual Blueprints with AnalyzeBlueprint to drill in
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static FBPProjectAnalysis QuickScanFolder(const FString& FolderPath);
+
+    // Strongly connected components of the dependency graph, each with one representative cycle
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static TArray<FBPDependencyCycle> FindDependencyCycles(const TArray<FBPDependency>& Dependencies);
+
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static FString ExportProjectAnalysisToJSON(const FBPProjectAnalysis& Analysis);
 
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static FString ExportProjectAnalysisToLLMText(const FBPProjectAnalysis& Analysis);
 
+    // JSON is streamed straight to disk, so large projects never hold the whole document in memory;
+    // BINARY writes the compact .bpab format (see FBPBinaryFormat)
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static bool SaveProjectAnalysisToFile(const FBPProjectAnalysis& Analysis, const FString& FilePath, const FString& Format = TEXT("JSON"));
+
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static bool LoadProjectAnalysisFromFile(const FString& FilePath, FBPProjectAnalysis& OutAnalysis);
+
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static TArray<FBPDependency> ExtractBlueprintDependencies(UBlueprint* Blueprint);
 
     UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
     static int32 EstimateTokenCount(const FString& Text);
 
+    // Exact length of ExportToLLMText(AnalysisResult), computed without building the string
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static int32 CountLLMTextChars(const FBlueprintAnalysisResult& AnalysisResult);
+
+    // Equivalent to EstimateTokenCount(ExportToLLMText(AnalysisResult)) with no text allocation
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer", meta=(CallInEditor="true"))
+    static int32 EstimateLLMTextTokenCount(const FBlueprintAnalysisResult& AnalysisResult);
+
     // New Widget Blueprint Analysis Functions
     UFUNCTION(BlueprintCallable, Category = "WidgetAnalyzer", meta=(CallInEditor="true"))
     static FWidgetOptimizationReport AnalyzeWidgetBlueprint(UBlueprint* WidgetBlueprint);
@@ -717,9 +1024,14 @@ public:
     static FString GenerateOptimizedWidgetCode(const FWidgetOptimizationReport& Report);
 
 private:
+    // Graph capture and the folder pipeline reuse the private extraction helpers below
+    friend class FBPSnapshotAnalyzer;
+    friend class FBPAnalysisPipeline;
+    friend class FBPRegistryScan;
+    friend class UBlueprintAnalyzerCommandlet;
+    friend class FBPFolderAnalysisJob;
+
     // Original Blueprint Analysis Helper Functions
-    static FBlueprintNodeInfo ExtractNodeInfo(UK2Node* Node);
-    static TArray<FBlueprintConnectionInfo> ExtractConnections(UEdGraph* Graph);
     static FString GetNodeTypeName(UK2Node* Node);
 
     // Phase 1: Metadata Extraction Helper Functions
@@ -728,17 +1040,16 @@ private:
     static FString GetPinTypeString(const struct FEdGraphPinType& PinType);
     static FString GetPropertyTypeString(const class FProperty* Property);
     static FString ExtractLiteralFromPin(const class UEdGraphPin* Pin);
-    static FString FindCommentGroupForNode(const class UEdGraphNode* Node, const class UEdGraph* Graph);
-
-    // Phase 2: Execution Flow Helpers
-    static TArray<FExecutionPath> TraceExecutionPaths(UBlueprint* Blueprint);
-    static void TraceFromNode(
-        class UK2Node* StartNode,
-        int32 Depth,
-        const FString& BranchLabel,
-        TArray<FExecutionStep>& OutSteps,
-        TSet<FGuid>& VisitedNodes);
-    static FString GetExecutionStepSummary(class UK2Node* Node);
+
+    // Length of ExportToLLMText(BuildAnalysisResult(Snapshot)) computed straight from the snapshot
+    static int64 CountSnapshotLLMTextChars(const struct FBPBlueprintSnapshot& Snapshot, const struct FBPTraceSet& Trace);
+
+    // Phase 4: Folder and dependency graph helpers
+    // Blueprint assets under any of the folders (recursive) plus the listed packages, sorted by package
+    static TArray<struct FAssetData> FindBlueprintAssets(const TArray<FString>& FolderPaths, const TArray<FString>& PackageNames);
+
+    // Fills DependencyCycles and CircularDependencyChains from Analysis.Dependencies
+    static void FindCircularDependencies(FBPProjectAnalysis& Analysis);
 
     // Widget Analysis Helper Functions
     static void AnalyzeWidgetHierarchy(UWidget* Widget, TArray<FWidgetHierarchyInfo>& OutHierarchy, int32 Depth = 0);
@@ -0,0 +1,44 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "BlueprintAnalyzerSnapshot.h"
+
+class UBlueprint;
+class UEdGraph;
+
+// ============================================================
+// Macro summary cache
+// Process-wide FBPMacroSummary per macro graph. A few standard macros
+// (ForEachLoop, ForLoop, WhileLoop, Gate...) are instanced thousands of
+// times across a project, so each macro graph is captured and summarized
+// on its first instance and shared by every later capture, across
+// Blueprints and batch runs. Summaries are dropped whenever a Blueprint
+// that defines macros is compiled, since a nested macro may have changed.
+// Game thread only; the summaries themselves are immutable and may be
+// read from any thread.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPMacroCache
+{
+public:
+    static FBPMacroCache& Get();
+
+    // Summary of MacroGraph, captured and summarized on first use
+    TSharedRef<const FBPMacroSummary> FindOrSummarize(UEdGraph* MacroGraph);
+
+    // Drops every summary when Blueprint defines macros; anything else cannot change a summary
+    void InvalidateBlueprint(const UBlueprint* Blueprint);
+
+    void Reset();
+
+    int32 Num() const { return Summaries.Num(); }
+
+private:
+    TMap<TObjectKey<UEdGraph>, TSharedRef<const FBPMacroSummary>> Summaries;
+
+    // Macros being summarized, so a (rejected by the compiler, but loadable) recursive macro terminates
+    TSet<TObjectKey<UEdGraph>> InProgress;
+};
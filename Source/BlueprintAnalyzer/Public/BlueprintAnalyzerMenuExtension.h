@@ -32,6 +32,7 @@ private:
 
     // Phase 4: Project Folder Analysis
     static void ExecuteAnalyzeFolder();
+    static void ExecuteQuickScanFolder();
     static void ExecuteExportProjectToJSON();
     static void ExecuteExportProjectToLLMText();
     static FString GetSelectedFolderPath();
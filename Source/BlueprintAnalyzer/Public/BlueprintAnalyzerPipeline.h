@@ -0,0 +1,138 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Tasks/Task.h"
+#include "IO/IoHash.h"
+#include "UObject/StrongObjectPtr.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerProfiling.h"
+#include "BlueprintAnalyzerIndex.h"
+#include "BlueprintAnalyzerSnapshot.h"
+#include "BlueprintAnalyzerCache.h"
+
+class UBlueprint;
+class UPackage;
+
+// Folder analysis pipeline
+//   Stage 0 (game thread, Step):  reuse the cached result when the saved hashes of the package and of the macro
+//                                 libraries it instances are unchanged;
+//                                 otherwise start an async load PrefetchWindow assets ahead
+//   Stage 1 (game thread, Step):  wait for the next Blueprint's load and capture a graph snapshot
+//   Stage 2 (task graph):         one fused walk over the snapshot (perf, dependencies, token count, index rows)
+//   Stage 3 (game thread, Finish): merge per-asset results in asset order, detect cycles, write the index
+// With ChunkSize / MemoryCeilingMB set, loaded packages are garbage collected between chunks;
+// only the compact per-asset results survive a chunk.
+class BLUEPRINTANALYZER_API FBPAnalysisPipeline
+{
+public:
+    FBPAnalysisPipeline(const FString& InFolderPath, const TArray<FAssetData>& InAssets, const FBPFolderAnalysisOptions& InOptions);
+
+    // Runs stage 1 for the next asset and hands the snapshot to a worker.
+    // Returns false once every asset has been dispatched.
+    bool Step();
+
+    // Waits for outstanding workers and produces the merged project analysis.
+    // Finishing before Step returns false merges only the assets completed so far.
+    FBPProjectAnalysis Finish();
+
+    // Game thread callback for each asset whose result becomes available (cache hit or analyzed).
+    // Package size and referencer counts are only filled in by Finish.
+    void SetOnAssetCompleted(TFunction<void(const FBPBlueprintSummary&)> InOnAssetCompleted) { OnAssetCompleted = MoveTemp(InOnAssetCompleted); }
+
+    int32 GetNumAssets() const { return Assets.Num(); }
+    int32 GetNumDispatched() const { return NextAsset; }
+    int32 GetWorkerCount() const { return WorkerCount; }
+    int32 GetNumCacheHits() const { return NumCacheHits; }
+    int32 GetNumCompleted() const { return NumCompleted; }
+    int64 GetPeakWorkingSetBytes() const { return PeakWorkingSetBytes; }
+    int32 GetLoadStalls() const { return LoadStalls; }
+    double GetLoadStallSeconds() const { return LoadStallSeconds; }
+
+private:
+    struct FAssetResult
+    {
+        bool bValid = false;
+        FBPBlueprintSummary Summary;
+        FBPPerformanceReport PerformanceReport;
+        TArray<FBPDependency> Dependencies;
+
+        // Kept until Finish only when Options.IndexFilePath is set
+        FBPIndexRows IndexRows;
+    };
+
+    // Per-asset load state; shared with async load callbacks so they can outlive the pipeline
+    struct FPrefetchSlot
+    {
+        bool bCacheHit = false;
+        bool bLoadFinished = false;
+        int32 RequestId = INDEX_NONE;
+
+        // Keeps a prefetched package alive across chunk garbage collections until it is analyzed
+        TStrongObjectPtr<UPackage> Package;
+    };
+
+    static FAssetResult AnalyzeSnapshot(const FBPBlueprintSnapshot& Snapshot, const FBPTraceLimits& Limits);
+
+    // Resolves cache hits and starts async loads up to PrefetchWindow assets past CurrentAsset
+    void PrefetchAhead(int32 CurrentAsset);
+
+    // Returns the loaded Blueprint, blocking on its package load if it has not finished yet
+    UBlueprint* WaitForBlueprint(int32 AssetIndex);
+
+    // Blocks on the oldest in-flight worker and stores its result
+    void RetireOldest();
+
+    // Stores a freshly analyzed result and records it in the persistent cache
+    void CompleteAsset(int32 AssetIndex, FAssetResult&& Result);
+
+    // Chunking: release everything loaded since the last chunk boundary
+    void SampleWorkingSet();
+    bool ShouldEndChunk() const;
+    void EndChunk();
+
+    FString FolderPath;
+    FString AnalysisTimestamp;
+    TArray<FAssetData> Assets;
+    FBPFolderAnalysisOptions Options;
+    int32 WorkerCount = 1;
+    int32 NextAsset = 0;
+    int32 NumCacheHits = 0;
+    int32 NumCompleted = 0;
+    TFunction<void(const FBPBlueprintSummary&)> OnAssetCompleted;
+
+    int32 NumLoadedInChunk = 0;
+    int32 ChunkCollections = 0;
+    int64 LastWorkingSetBytes = 0;
+    int64 PeakWorkingSetBytes = 0;
+    bool bWarnedAboveCeiling = false;
+
+    // Load callbacks hold a weak reference, so loads finishing after the pipeline is gone are ignored
+    TSharedRef<TArray<FPrefetchSlot>> Slots;
+    int32 NextPrefetch = 0;
+    int32 PrefetchedPackages = 0;
+    int32 LoadStalls = 0;
+    double LoadStallSeconds = 0.0;
+
+    // Opened at construction; the run's StageTimings are taken from it at Finish
+    FBPStageProfiler::FRun StageRun;
+
+    // Package saved hash per asset, captured before loading so cache entries match what was analyzed
+    TArray<FIoHash> SavedHashes;
+
+    // Saved hashes of the macro libraries each analyzed asset instances, taken at capture.
+    // Assets whose macro libraries have unsaved edits are not cached (MacroPackagesSaved false).
+    TArray<TArray<FBPPackageHash>> MacroPackageHashes;
+    TBitArray<> MacroPackagesSaved;
+
+    // Read once so every asset in the run, and its cache entry, is traced with the same limits
+    FBPTraceLimits TraceLimits;
+
+    // Indexed like Assets so the merge order never depends on worker scheduling
+    TArray<FAssetResult> Results;
+
+    // FIFO of (asset index, task); bounded by WorkerCount
+    TArray<TPair<int32, UE::Tasks::TTask<FAssetResult>>> InFlight;
+};
@@ -0,0 +1,122 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+struct FBPStageTiming;
+
+DECLARE_STATS_GROUP(TEXT("BlueprintAnalyzer"), STATGROUP_BlueprintAnalyzer, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load"), STAT_BlueprintAnalyzer_Load, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Metadata"), STAT_BlueprintAnalyzer_Metadata, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Graph capture"), STAT_BlueprintAnalyzer_GraphCapture, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tracing"), STAT_BlueprintAnalyzer_Tracing, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Snapshot walk"), STAT_BlueprintAnalyzer_Walk, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Token count"), STAT_BlueprintAnalyzer_TokenCount, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Widget analysis"), STAT_BlueprintAnalyzer_WidgetAnalysis, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Export JSON"), STAT_BlueprintAnalyzer_ExportJSON, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Export LLM text"), STAT_BlueprintAnalyzer_ExportLLMText, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Export binary"), STAT_BlueprintAnalyzer_ExportBinary, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Export index"), STAT_BlueprintAnalyzer_ExportIndex, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cycle detection"), STAT_BlueprintAnalyzer_CycleDetection, STATGROUP_BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+
+LLM_DECLARE_TAG_API(BlueprintAnalyzer, BLUEPRINTANALYZER_API);
+
+// Stages reported in StageTimings. Node/connection extraction, perf rules and dependency
+// extraction share one snapshot walk and are timed per visitor inside FBPSnapshotAnalyzer::Walk.
+enum class EBPAnalyzerStage : uint8
+{
+    Load,
+    Metadata,
+    GraphCapture,
+    NodeExtraction,
+    ConnectionExtraction,
+    Tracing,
+    PerfRules,
+    DependencyExtraction,
+    TokenCount,
+    WidgetAnalysis,
+    ExportJSON,
+    ExportLLMText,
+    CycleDetection,
+    ExportBinary,
+    ExportIndex,
+
+    Num
+};
+
+// ============================================================
+// Stage profiler
+// Process-wide per-stage counters, accumulated only while profiling is on
+// (BlueprintAnalyzer.Profile 1, or -Profile on the commandlets). A report
+// opens an FRun when it starts and attaches its timings when it ends:
+// time and calls are the difference of the counters, memory peaks are
+// sampled into every open run. Concurrent analyses in the same process are
+// attributed to whichever reports overlap them.
+// Stat and trace scopes are independent of this switch and always compiled in.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPStageProfiler
+{
+public:
+    // One report's view of the counters, from construction until destruction
+    class BLUEPRINTANALYZER_API FRun : public FNoncopyable
+    {
+    public:
+        FRun();
+        ~FRun();
+
+        // Stages that ran since construction; PeakUsedPhysical is the highest sample taken since then
+        TArray<FBPStageTiming> GetTimings() const;
+
+    private:
+        friend class FBPStageProfiler;
+
+        uint64 BeginCycles[(int32)EBPAnalyzerStage::Num] = {};
+        uint32 BeginCalls[(int32)EBPAnalyzerStage::Num] = {};
+
+        // Written by SampleMemory under the open run lock
+        uint64 PeakUsedPhysical[(int32)EBPAnalyzerStage::Num] = {};
+    };
+
+    static bool IsEnabled();
+    static void SetEnabled(bool bEnabled);
+
+    static void Add(EBPAnalyzerStage Stage, uint64 Cycles, uint32 Calls);
+
+    // Add for time measured by hand inside an open stage scope; excludes it from that scope
+    static void AddNested(EBPAnalyzerStage Stage, uint64 Cycles, uint32 Calls);
+
+    // Records process physical memory in use at the end of a stage into every open run
+    static void SampleMemory(EBPAnalyzerStage Stage);
+
+    static const TCHAR* GetStageName(EBPAnalyzerStage Stage);
+};
+
+// Exclusive wall time of a stage on the current thread: a nested stage pauses its parent
+class BLUEPRINTANALYZER_API FBPStageScope
+{
+public:
+    explicit FBPStageScope(EBPAnalyzerStage InStage);
+    ~FBPStageScope();
+
+private:
+    friend class FBPStageProfiler;
+
+    EBPAnalyzerStage Stage;
+    FBPStageScope* Parent = nullptr;
+    uint64 StartCycles = 0;
+    uint64 ElapsedCycles = 0;
+    bool bActive = false;
+};
+
+// Stat, Insights CPU trace event, LLM tag and report timing for one stage
+#define BPA_STAGE_SCOPE(StageName) \
+    LLM_SCOPE_BYTAG(BlueprintAnalyzer); \
+    TRACE_CPUPROFILER_EVENT_SCOPE(BlueprintAnalyzer_##StageName); \
+    SCOPE_CYCLE_COUNTER(STAT_BlueprintAnalyzer_##StageName); \
+    FBPStageScope BPAStageScope_##StageName(EBPAnalyzerStage::StageName)
@@ -0,0 +1,29 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "BlueprintAnalyzerLibrary.h"
+
+// ============================================================
+// Registry-only ("quick scan") analysis
+// Everything here reads asset registry tags and package dependency data;
+// no package is ever loaded, so whole /Game trees can be triaged interactively.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPRegistryScan
+{
+public:
+    // Summary from registry tags alone (type, parent class, interfaces) plus package info
+    static FBPBlueprintSummary SummarizeAsset(const FAssetData& AssetData);
+
+    // Package size and hard/soft/referencer counts; shared with full folder analysis
+    static void FillPackageInfo(const FAssetData& AssetData, FBPBlueprintSummary& Summary);
+
+    // Quick scan of pre-sorted assets; dependencies are hard package references inside the set
+    static FBPProjectAnalysis ScanFolder(const FString& FolderPath, const TArray<FAssetData>& Assets);
+
+private:
+    static FString GetBlueprintTypeFromTags(const FAssetData& AssetData);
+};
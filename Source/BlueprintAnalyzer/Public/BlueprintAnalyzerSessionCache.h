@@ -0,0 +1,132 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerIncremental.h"
+#include "BlueprintAnalyzerSessionCache.generated.h"
+
+class UBlueprint;
+class UEdGraph;
+class FObjectPostSaveContext;
+struct FAssetData;
+struct FEdGraphEditAction;
+
+// ============================================================
+// Editor session cache
+// Keeps the latest result of each analysis per Blueprint package and per
+// analyzed folder for the lifetime of the editor, so analyze-then-export
+// menu flows run the analysis once. Unlike FBPAnalysisCache this also
+// covers packages with unsaved edits: entries are dropped as soon as the
+// package is modified, saved, compiled, added, removed or renamed.
+//
+// With BlueprintAnalyzer.Incremental (on by default) the analysis and perf
+// report of a Blueprint are instead kept as an FBPIncrementalAnalysis: edits
+// only mark the touched graphs dirty, and after each compile those graphs are
+// re-extracted and patched in, so the updated score is ready right away.
+// Game thread only.
+// ============================================================
+
+UCLASS()
+class BLUEPRINTANALYZER_API UBlueprintAnalyzerSessionCache : public UEditorSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Fires after a compile has patched the incremental analysis of a Blueprint analyzed this session
+    DECLARE_MULTICAST_DELEGATE_TwoParams(FOnBlueprintReanalyzed, UBlueprint* /*Blueprint*/, const FBPPerformanceReport& /*Report*/);
+
+    // nullptr outside the editor
+    static UBlueprintAnalyzerSessionCache* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Cached results, computed through UBlueprintAnalyzerLibrary on a miss
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer|Cache")
+    FBlueprintAnalysisResult GetBlueprintAnalysis(UBlueprint* Blueprint);
+
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer|Cache")
+    FBPPerformanceReport GetPerformanceReport(UBlueprint* Blueprint);
+
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer|Cache")
+    FWidgetOptimizationReport GetWidgetReport(UBlueprint* Blueprint);
+
+    // Latest complete folder analysis for FolderPath, nullptr if none is cached or it went stale
+    const FBPProjectAnalysis* FindFolderAnalysis(const FString& FolderPath) const;
+
+    // Call when a folder analysis starts; returns the token its result is stored with
+    uint64 BeginFolderAnalysis(const FString& FolderPath);
+
+    // Ignored if a package under the folder was modified, saved, compiled, added, removed or
+    // renamed after the run with Token began, since the run may have read it either way
+    void StoreFolderAnalysis(const FBPProjectAnalysis& Analysis, uint64 Token);
+
+    // Drops the package's entries and every cached folder containing it
+    void InvalidatePackage(FName PackageName);
+
+    UFUNCTION(BlueprintCallable, Category = "BlueprintAnalyzer|Cache")
+    void ClearSessionCache();
+
+    FOnBlueprintReanalyzed& OnBlueprintReanalyzed() { return BlueprintReanalyzedEvent; }
+
+private:
+    struct FAssetEntry
+    {
+        TOptional<FBlueprintAnalysisResult> Analysis;
+        FBPTraceLimits AnalysisTraceLimits;
+        TOptional<FBPPerformanceReport> PerformanceReport;
+        TOptional<FWidgetOptimizationReport> WidgetReport;
+
+        // Incremental mode: replaces Analysis and PerformanceReport, patched instead of dropped on edits
+        TOptional<FBPIncrementalAnalysis> Incremental;
+        TSet<TObjectKey<UEdGraph>> DirtyGraphs;
+        bool bIncrementalStale = false;
+        TArray<TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>> GraphWatches;
+    };
+
+    FAssetEntry* FindOrAddEntry(UBlueprint* Blueprint);
+
+    // Builds or patches the entry's incremental analysis; returns the graphs re-extracted
+    int32 RefreshIncremental(UBlueprint* Blueprint, FAssetEntry& Entry);
+    void WatchGraphs(UBlueprint* Blueprint, FAssetEntry& Entry);
+    static void UnwatchGraphs(FAssetEntry& Entry);
+
+    // Edit inside the package: incremental entries only record the dirty graph, others are dropped
+    void MarkPackageEdited(FName PackageName, const UObject* EditedObject);
+    void InvalidateFolders(FName PackageName);
+
+    // A Blueprint defining macros is compiling; drops every result that may instance its macros
+    void InvalidateMacroDependents(FName MacroPackageName);
+
+    void HandleObjectModified(UObject* Object);
+    void HandleGraphChanged(const FEdGraphEditAction& Action);
+    void HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+    void HandleBlueprintPreCompile(UBlueprint* Blueprint);
+    void HandleBlueprintCompiled();
+    void HandleAssetChanged(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    // Keyed by package name; a Blueprint package holds exactly one Blueprint
+    TMap<FName, FAssetEntry> AssetEntries;
+    TMap<FString, FBPProjectAnalysis> FolderEntries;
+
+    // Per folder analyzed this session, ChangeSerial at the last change to a package under it
+    TMap<FString, uint64> FolderChangeSerials;
+    uint64 ChangeSerial = 0;
+
+    // Incremental entries between OnBlueprintPreCompile and OnBlueprintCompiled
+    TArray<TWeakObjectPtr<UBlueprint>> PendingCompiles;
+    FOnBlueprintReanalyzed BlueprintReanalyzedEvent;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle PreCompileHandle;
+    FDelegateHandle CompiledHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -0,0 +1,436 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphPin.h"
+#include "BlueprintAnalyzerLibrary.h"
+#include "BlueprintAnalyzerProfiling.h"
+
+class UBlueprint;
+class UEdGraph;
+
+// ============================================================
+// Graph snapshot: plain-data copy of a Blueprint's graphs.
+// Captured on the game thread; everything downstream (node info,
+// connections, tracing, perf rules, dependencies) reads only this
+// data and is therefore safe to run on task graph workers.
+//
+// Nodes and pins have dense indices; links and node adjacency are
+// CSR arrays over those indices and pin names are FNames, so the
+// analysis passes never touch strings for identity. GUID strings are
+// produced only when results are exported.
+// ============================================================
+
+enum class EBPGraphKind : uint8
+{
+    Ubergraph,
+    Function,
+    Macro,
+    DelegateSignature,
+    Intermediate,
+
+    // Bound graph of a collapsed (UK2Node_Composite) node, captured after every other kind
+    Collapsed
+};
+
+struct FBPPinLink
+{
+    // Linked K2Node and pin (indices into Nodes / Pins). When the linked node is not a
+    // K2Node, NodeIndex is INDEX_NONE and PinIndex indexes ExternalPins instead.
+    int32 NodeIndex = INDEX_NONE;
+    int32 PinIndex = INDEX_NONE;
+
+    bool IsExternal() const { return NodeIndex == INDEX_NONE; }
+};
+
+// Exec structure of one macro graph, nested macros included. Summarized once per macro and
+// shared by every snapshot with an instance of it (see FBPMacroCache); immutable once built.
+struct FBPMacroSummary
+{
+    FString MacroName;
+
+    // K2Nodes one instance runs, counting the bodies of nested macros
+    int32 NodeCount = 0;
+
+    // Exec flow cycles inside the macro (ForLoop, WhileLoop, ForEachLoop...)
+    bool bHasLoop = false;
+    bool bHasBranch = false;
+    bool bIsLatent = false;
+
+    // Exec outputs in pin order; LoopOutputs are the ones fired once per iteration
+    TArray<FName> ExecOutputs;
+    TArray<FName> LoopOutputs;
+
+    // Functions called inside the macro, nested macros included
+    TArray<FString> CalledFunctions;
+
+    // Packages defining the macro and its nested macros; anything derived from the summary depends on them
+    TArray<FName> Packages;
+
+    bool IsLoopOutput(FName PinName) const { return LoopOutputs.Contains(PinName); }
+};
+
+// Link target outside the K2Node set; kept only so connection exports stay complete
+struct FBPExternalPin
+{
+    FGuid NodeGuid;
+    FName PinName;
+};
+
+struct FBPPinSnapshot
+{
+    FName PinName;
+    FString TypeString;
+    EEdGraphPinDirection Direction = EGPD_Input;
+    bool bIsExec = false;
+    int32 OwnerNode = INDEX_NONE;
+
+    // Literal on a disconnected input pin (see ExtractLiteralFromPin)
+    FString Literal;
+
+    // Name of Pin->DefaultObject, and the Blueprint name when that object is a UBlueprint
+    FString DefaultObjectName;
+    FString DefaultBlueprintName;
+};
+
+struct FBPNodeSnapshot
+{
+    FGuid NodeGuid;
+    int32 GraphIndex = INDEX_NONE;
+
+    FString NodeType;
+    FString Title;
+    FString FunctionName;
+    FString StepSummary;
+    FString CommentGroup;
+
+    // UK2Node_CallFunction target and the class that owns it
+    FString CallFunctionName;
+    FString CallOwnerClass;
+
+    // UK2Node_DynamicCast target
+    FString CastTargetClass;
+
+    // Graph this node runs: the Blueprint's own function for a self call (Function kind), or the
+    // bound graph of a collapsed node (Collapsed kind). CalleeEntryNode is that graph's entry when
+    // it was captured alongside this node.
+    FString CalleeGraphName;
+    EBPGraphKind CalleeGraphKind = EBPGraphKind::Function;
+    int32 CalleeEntryNode = INDEX_NONE;
+
+    // UK2Node_MacroInstance summary (index into FBPBlueprintSnapshot::Macros)
+    int32 MacroIndex = INDEX_NONE;
+
+    // This node's pins are Pins[FirstPin .. FirstPin + NumPins)
+    int32 FirstPin = 0;
+    int32 NumPins = 0;
+
+    // UK2Node_IfThenElse exec outputs (indices into FBPBlueprintSnapshot::Pins)
+    int32 ThenPinIndex = INDEX_NONE;
+    int32 ElsePinIndex = INDEX_NONE;
+
+    bool bIsEvent = false;
+    bool bIsFunctionEntry = false;
+    bool bIsTickEvent = false;
+    bool bIsBeginPlayEvent = false;
+    bool bIsCallFunction = false;
+    bool bIsCast = false;
+    bool bIsSpawnActor = false;
+    bool bIsBranch = false;
+    bool bIsSequence = false;
+    bool bIsLatent = false;
+
+    // UK2Node_Tunnel feeding a collapsed or macro graph's inputs into its body, and the one
+    // passing its exec and data outputs back out
+    bool bIsTunnelEntry = false;
+    bool bIsTunnelExit = false;
+};
+
+struct FBPGraphSnapshot
+{
+    FString GraphName;
+    EBPGraphKind Kind = EBPGraphKind::Ubergraph;
+
+    // Graph->Nodes.Num(), including comments and other non-K2 nodes
+    int32 TotalNodeCount = 0;
+
+    // Range of this graph's K2Nodes in FBPBlueprintSnapshot::Nodes
+    int32 FirstNode = 0;
+    int32 NumNodes = 0;
+
+    // FunctionEntry of a function graph, input tunnel of a collapsed or macro graph
+    int32 EntryNode = INDEX_NONE;
+
+    // Captured only so calls and timers in the other graphs resolve (see CaptureGraphInContext);
+    // skipped by Walk and by TraceExecutionPaths' output
+    bool bIsContext = false;
+};
+
+struct FBPBlueprintSnapshot
+{
+    FString BlueprintName;
+    FString BlueprintPath;
+    FString BlueprintType;
+    FBPAnalyzerMetadata Metadata;
+
+    TArray<FBPGraphSnapshot> Graphs;
+    TArray<FBPNodeSnapshot> Nodes;
+    TArray<FBPPinSnapshot> Pins;
+
+    // Links of pin P are PinLinks[PinLinkOffsets[P] .. PinLinkOffsets[P + 1]), in UEdGraphPin::LinkedTo order
+    TArray<int32> PinLinkOffsets;
+    TArray<FBPPinLink> PinLinks;
+    TArray<FBPExternalPin> ExternalPins;
+
+    // Summaries of the macros instanced in these graphs, one per macro
+    TArray<TSharedRef<const FBPMacroSummary>> Macros;
+
+    // Node adjacency over K2Nodes, CSR indexed like Nodes (NumNodes + 1 offsets).
+    // Exec: successors through exec outputs. Data: producers feeding data inputs.
+    TArray<int32> ExecOffsets;
+    TArray<int32> ExecTargets;
+    TArray<int32> DataOffsets;
+    TArray<int32> DataSources;
+
+    bool IsValid() const { return !BlueprintName.IsEmpty(); }
+
+    // Packages of every macro instanced in these graphs, nested macros included
+    TArray<FName> GetMacroPackages() const
+    {
+        TArray<FName> Packages;
+        for (const TSharedRef<const FBPMacroSummary>& Macro : Macros)
+        {
+            for (const FName Package : Macro->Packages)
+            {
+                Packages.AddUnique(Package);
+            }
+        }
+        return Packages;
+    }
+
+    const FBPGraphSnapshot& GetGraph(const FBPNodeSnapshot& Node) const { return Graphs[Node.GraphIndex]; }
+
+    TConstArrayView<FBPPinSnapshot> GetPins(const FBPNodeSnapshot& Node) const { return MakeArrayView(Pins.GetData() + Node.FirstPin, Node.NumPins); }
+
+    TConstArrayView<FBPPinLink> GetLinks(int32 PinIndex) const
+    {
+        return MakeArrayView(PinLinks.GetData() + PinLinkOffsets[PinIndex], PinLinkOffsets[PinIndex + 1] - PinLinkOffsets[PinIndex]);
+    }
+
+    TConstArrayView<int32> GetExecSuccessors(int32 NodeIndex) const
+    {
+        return MakeArrayView(ExecTargets.GetData() + ExecOffsets[NodeIndex], ExecOffsets[NodeIndex + 1] - ExecOffsets[NodeIndex]);
+    }
+
+    TConstArrayView<int32> GetDataSources(int32 NodeIndex) const
+    {
+        return MakeArrayView(DataSources.GetData() + DataOffsets[NodeIndex], DataOffsets[NodeIndex + 1] - DataOffsets[NodeIndex]);
+    }
+
+    // Identity of a link target, resolved only when exporting
+    const FGuid& GetLinkedNodeGuid(const FBPPinLink& Link) const
+    {
+        return Link.IsExternal() ? ExternalPins[Link.PinIndex].NodeGuid : Nodes[Link.NodeIndex].NodeGuid;
+    }
+
+    FName GetLinkedPinName(const FBPPinLink& Link) const
+    {
+        return Link.IsExternal() ? ExternalPins[Link.PinIndex].PinName : Pins[Link.PinIndex].PinName;
+    }
+};
+
+// Execution trace in node indices; converted to FExecutionPath (with GUID strings) only for export
+struct FBPTraceStep
+{
+    int32 NodeIndex = INDEX_NONE;
+    int32 Depth = 0;
+    FName BranchLabel;
+
+    // Revisit of an already traced node ("Loopback" in exports), or a truncation marker
+    bool bIsTerminator = false;
+
+    // A trace limit stopped the trace at NodeIndex, which was not traced ("Truncated" in exports)
+    bool bIsTruncated = false;
+
+    // NodeIndex starts FBPTraceSet::Segments[SegmentIndex]; the flow continues there (also a terminator)
+    int32 SegmentIndex = INDEX_NONE;
+
+    // Expanded calls enclosing this step; zero outside any callee body
+    int32 CallDepth = 0;
+
+    // NodeIndex calls a graph already being expanded around it, so it was not expanded again
+    bool bIsRecursiveCall = false;
+};
+
+struct FBPTracePath
+{
+    int32 EntryNode = INDEX_NONE;
+
+    // Steps are FBPTraceSet::Steps[FirstStep .. FirstStep + NumSteps)
+    int32 FirstStep = 0;
+    int32 NumSteps = 0;
+
+    // At least one step is a truncation marker
+    bool bTruncated = false;
+};
+
+// All execution paths of one Blueprint as a DAG: flow that more than one entry reaches is
+// traced once as a segment and referenced from every path that reaches it. Segments are
+// ordered by first node, so graphs captured separately concatenate in the same order.
+// The steps of every path and segment share one array.
+struct FBPTraceSet
+{
+    TArray<FBPTracePath> Paths;
+    TArray<FBPTracePath> Segments;
+    TArray<FBPTraceStep> Steps;
+
+    TConstArrayView<FBPTraceStep> GetSteps(const FBPTracePath& Path) const
+    {
+        return MakeArrayView(Steps.GetData() + Path.FirstStep, Path.NumSteps);
+    }
+};
+
+// Zero means unlimited. Depth counts nested branch outputs; steps count one path's or segment's
+// steps. Without limits the whole trace is linear in graph size for typical graphs: a node
+// reached from several entries is traced once, in a shared segment.
+//
+// MaxCallDepth is the number of nested calls into the Blueprint's own functions and collapsed
+// graphs expanded inline (zero = none). Each callee body is traced once and copied under its
+// call sites; expansion stops early once a path reaches MaxStepsPerPath steps.
+struct BLUEPRINTANALYZER_API FBPTraceLimits
+{
+    int32 MaxDepth = 0;
+    int32 MaxStepsPerPath = 0;
+    int32 MaxCallDepth = 0;
+
+    // BlueprintAnalyzer.TraceMaxDepth / BlueprintAnalyzer.TraceMaxSteps / BlueprintAnalyzer.TraceCallDepth
+    static FBPTraceLimits FromConsoleVariables();
+
+    bool operator==(const FBPTraceLimits& Other) const
+    {
+        return MaxDepth == Other.MaxDepth && MaxStepsPerPath == Other.MaxStepsPerPath && MaxCallDepth == Other.MaxCallDepth;
+    }
+
+    bool operator!=(const FBPTraceLimits& Other) const { return !(*this == Other); }
+
+    friend FArchive& operator<<(FArchive& Ar, FBPTraceLimits& Limits)
+    {
+        return Ar << Limits.MaxDepth << Limits.MaxStepsPerPath << Limits.MaxCallDepth;
+    }
+};
+
+// Receives one Blueprint's nodes and pins during a single shared walk.
+// WantsGraph filters which graphs a visitor sees; all callbacks run on the walking thread.
+class IBPSnapshotVisitor
+{
+public:
+    virtual ~IBPSnapshotVisitor() = default;
+
+    virtual bool WantsGraph(const FBPGraphSnapshot& Graph) const { return true; }
+    virtual void BeginWalk(const FBPBlueprintSnapshot& Snapshot) {}
+    virtual void BeginGraph(const FBPBlueprintSnapshot& Snapshot, const FBPGraphSnapshot& Graph) {}
+    virtual void VisitNode(const FBPBlueprintSnapshot& Snapshot, int32 NodeIndex, const FBPNodeSnapshot& Node) {}
+    virtual void VisitPin(const FBPBlueprintSnapshot& Snapshot, const FBPNodeSnapshot& Node, int32 PinIndex, const FBPPinSnapshot& Pin) {}
+    virtual void EndWalk(const FBPBlueprintSnapshot& Snapshot) {}
+
+    // Stage this visitor's callbacks are reported under when profiling; Num leaves them untracked
+    virtual EBPAnalyzerStage GetStage() const { return EBPAnalyzerStage::Num; }
+};
+
+// Everything the batch pipeline needs from one Blueprint, produced by one walk
+struct FBPSnapshotAnalysis
+{
+    FBPPerformanceReport PerformanceReport;
+    TArray<FBPDependency> Dependencies;
+    int32 SummaryNodeCount = 0;
+
+    // Length of ExportToLLMText for this Blueprint, measured without building the analysis result
+    int64 LLMTextChars = 0;
+
+    // Execution paths the token count was measured from; reused for exec reachability
+    FBPTraceSet Trace;
+};
+
+// Inputs of the perf rules for a set of event graphs. Exec flow never leaves a graph, so
+// facts gathered from separate graph captures can be appended and the rules applied once.
+struct BLUEPRINTANALYZER_API FBPPerformanceFacts
+{
+    int32 TotalNodes = 0;
+    int32 EventCount = 0;
+    int32 CastCount = 0;
+    int32 TickNodeCount = 0;
+    int32 BeginPlayNodeCount = 0;
+
+    // Per-node rule hits in Tick reach order, already capped per rule
+    TArray<FBPPerformanceIssue> TickCallIssues;
+    TArray<FBPPerformanceIssue> TickCastIssues;
+
+    // Loops on paths run from Tick or a looping timer, per rule
+    TArray<FBPPerformanceIssue> HotLoopIssues;
+    TArray<FBPPerformanceIssue> NestedLoopIssues;
+    TArray<FBPPerformanceIssue> LoopOverActorsIssues;
+    TArray<FBPPerformanceIssue> LoopSearchIssues;
+
+    // One per Tick event (see FBPCostModel)
+    TArray<FBPTickPathCost> TickPathCosts;
+
+    void Append(const FBPPerformanceFacts& Other);
+};
+
+class BLUEPRINTANALYZER_API FBPSnapshotAnalyzer
+{
+public:
+    // Game thread only: walks every graph once and copies what the analysis passes need
+    static FBPBlueprintSnapshot Capture(UBlueprint* Blueprint);
+
+    // Game thread only: snapshot of a single graph (no metadata), for incremental updates
+    static FBPBlueprintSnapshot CaptureGraph(UBlueprint* Blueprint, UEdGraph* Graph, EBPGraphKind Kind);
+
+    // Game thread only: CaptureGraph plus, as context graphs, every graph in Graphs that Graph's calls
+    // reach, directly or through other callees, and every other graph when a looping timer in an
+    // event graph names its function. Analyzing the result covers Graph alone, with callee bodies
+    // costed, traced and searched by the hot loop rules as in a full capture. OutContextGraphs lists
+    // the context graphs.
+    static FBPBlueprintSnapshot CaptureGraphInContext(UBlueprint* Blueprint, UEdGraph* Graph, EBPGraphKind Kind,
+        const TArray<TPair<UEdGraph*, EBPGraphKind>>& Graphs, TArray<UEdGraph*>& OutContextGraphs);
+
+    // Bound graphs of the collapsed nodes in Graphs and, recursively, in those bound graphs
+    static void GatherCollapsedGraphs(const TArray<UEdGraph*>& Graphs, TArray<UEdGraph*>& OutCollapsedGraphs);
+
+    // Exec structure of a macro graph captured on its own (Macro kind); nested macros come from Snapshot.Macros
+    static void SummarizeMacro(const FBPBlueprintSnapshot& Snapshot, FBPMacroSummary& OutSummary);
+
+    // Thread-safe: operate on captured data only
+    // Also collects the perf rule inputs in the same walk when OutPerformanceFacts is set
+    static FBlueprintAnalysisResult BuildAnalysisResult(const FBPBlueprintSnapshot& Snapshot, FBPPerformanceFacts* OutPerformanceFacts = nullptr,
+        const FBPTraceLimits& Limits = FBPTraceLimits::FromConsoleVariables());
+    static FBPPerformanceReport AnalyzePerformance(const FBPBlueprintSnapshot& Snapshot);
+
+    // Fills the report counts, issues and score from (possibly appended) facts
+    static void ApplyPerformanceRules(const FBPPerformanceFacts& Facts, FBPPerformanceReport& Report);
+    static TArray<FBPDependency> ExtractDependencies(const FBPBlueprintSnapshot& Snapshot);
+    static void TraceExecutionPaths(const FBPBlueprintSnapshot& Snapshot, TArray<FExecutionPath>& OutPaths, TArray<FExecutionPath>& OutSharedSegments,
+        const FBPTraceLimits& Limits = FBPTraceLimits::FromConsoleVariables());
+
+    // Execution paths in node indices; shared by exports, token counting and later passes
+    static FBPTraceSet TraceCompact(const FBPBlueprintSnapshot& Snapshot, const FBPTraceLimits& Limits = FBPTraceLimits::FromConsoleVariables());
+    static FExecutionPath ToExecutionPath(const FBPBlueprintSnapshot& Snapshot, const FBPTraceSet& Trace, const FBPTracePath& Path);
+
+    // Text put before the node's StepSummary in an exported step ("-> back to " for a loopback; empty for a traced node)
+    static const TCHAR* GetStepSummaryPrefix(const FBPTraceStep& Step);
+
+    // Node count used by project summaries (event + function graphs, all node kinds)
+    static int32 CountSummaryNodes(const FBPBlueprintSnapshot& Snapshot);
+
+    // Visits every graph -> node -> pin exactly once, fanning each element out to the visitors
+    static void Walk(const FBPBlueprintSnapshot& Snapshot, TArrayView<IBPSnapshotVisitor* const> Visitors);
+
+    // Summary count, perf rules, dependencies and LLM text size in a single walk
+    static FBPSnapshotAnalysis AnalyzeAll(const FBPBlueprintSnapshot& Snapshot, const FBPTraceLimits& Limits = FBPTraceLimits::FromConsoleVariables());
+
+private:
+    static void CaptureGraphs(const TArray<UEdGraph*>& Graphs, EBPGraphKind Kind, FBPBlueprintSnapshot& Snapshot);
+    static void BuildAdjacency(FBPBlueprintSnapshot& Snapshot);
+    static void ResolveCallees(FBPBlueprintSnapshot& Snapshot);
+};
@@ -0,0 +1,26 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ============================================================
+// String table keys
+// FString's == and GetTypeHash ignore case, so a default TMap<FString, ...>
+// used to intern strings hands "Branch" the index of "branch". Tables that
+// write strings back out key them with these instead.
+// ============================================================
+
+template<typename ValueType>
+struct TBPCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+{
+    static bool Matches(const FString& A, const FString& B)
+    {
+        return A.Equals(B, ESearchCase::CaseSensitive);
+    }
+
+    static uint32 GetKeyHash(const FString& Key)
+    {
+        return FCrc::StrCrc32(*Key);
+    }
+};
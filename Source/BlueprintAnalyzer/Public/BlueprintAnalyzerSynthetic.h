@@ -0,0 +1,51 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UWidgetBlueprint;
+
+// Shape of a generated Blueprint
+struct FBPSyntheticShape
+{
+    // Executable nodes across the event graph and all functions, not counting comments
+    int32 NodeCount = 1000;
+
+    // Every BranchEvery-th node splits the execution flow: alternately a Branch (2 outputs)
+    // or a Sequence with FanOut outputs
+    int32 BranchEvery = 8;
+    int32 FanOut = 3;
+
+    // Comment boxes per 100 nodes, each framing a run of consecutive nodes
+    int32 CommentsPer100Nodes = 5;
+
+    // Function graphs besides the event graph; nodes are split evenly between all graphs
+    int32 FunctionCount = 4;
+
+    // Root the event graph at Tick and call every function from it first, so Tick costs and
+    // call expansion reach into the function graphs
+    bool bTickCallsFunctions = false;
+
+    // Widget Blueprints: panel nesting depth and total widget count
+    int32 WidgetDepth = 6;
+    int32 WidgetCount = 100;
+};
+
+// ============================================================
+// Synthetic Blueprint generator
+// Builds Actor and Widget Blueprints of a given shape in transient packages
+// under /Temp/BlueprintAnalyzer, for benchmarking the analyzer at sizes no
+// sample project has. Graphs are wired but never compiled. Game thread only.
+// ============================================================
+
+class BLUEPRINTANALYZER_API FBPSyntheticBlueprints
+{
+public:
+    static UBlueprint* CreateActorBlueprint(const FString& Name, const FBPSyntheticShape& Shape);
+    static UWidgetBlueprint* CreateWidgetBlueprint(const FString& Name, const FBPSyntheticShape& Shape);
+
+    // Makes a generated Blueprint and its package collectable by the next garbage collection
+    static void Discard(UBlueprint* Blueprint);
+};
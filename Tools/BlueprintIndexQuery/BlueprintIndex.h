@@ -0,0 +1,366 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+#pragma once
+
+// ============================================================
+// Read-only view of a BlueprintAnalyzer project index (.bpidx)
+// Header-only and Unreal-free: the file is memory mapped and every column is
+// viewed in place. Mirrors Source/BlueprintAnalyzer/Public/BlueprintAnalyzerIndex.h;
+// keep the two in sync and bump the version together.
+// ============================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bpindex
+{
+
+enum Section : uint32_t
+{
+    Section_Blueprints,
+    Section_NodeType,
+    Section_NodeName,
+    Section_NodeGraph,
+    Section_NodeFlags,
+    Section_ReachNode,
+    Section_ReachEntry,
+    Section_DepClass,
+    Section_DepType,
+    Section_DepGraph,
+    Section_StringOffsets,
+    Section_StringData,
+
+    Section_Num
+};
+
+enum NodeFlags : uint8_t
+{
+    Node_Event = 1 << 0,
+    Node_FunctionEntry = 1 << 1,
+    Node_Tick = 1 << 2,
+    Node_BeginPlay = 1 << 3,
+    Node_Latent = 1 << 4,
+};
+
+struct Header
+{
+    static constexpr uint32_t MagicValue = 0x58495042; // 'BPIX'
+    static constexpr uint32_t CurrentVersion = 2;
+
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t NumBlueprints;
+    uint32_t NumNodes;
+    uint32_t NumReach;
+    uint32_t NumDependencies;
+    uint32_t NumStrings;
+    uint32_t Reserved;
+    uint64_t SectionOffsets[Section_Num];
+    uint64_t FileSize;
+};
+static_assert(sizeof(Header) == 136, "Header layout is part of the file format");
+
+struct BlueprintRecord
+{
+    uint32_t Path;
+    uint32_t Name;
+    uint32_t Type;
+    uint32_t ParentClass;
+    uint32_t FirstNode;
+    uint32_t NumNodes;
+    uint32_t FirstReach;
+    uint32_t NumReach;
+    uint32_t FirstDependency;
+    uint32_t NumDependencies;
+    int32_t PerformanceScore;
+    int32_t EstimatedTokenCount;
+};
+static_assert(sizeof(BlueprintRecord) == 48, "BlueprintRecord layout is part of the file format");
+
+template<typename T>
+struct Column
+{
+    const T* Data = nullptr;
+    size_t Count = 0;
+
+    const T* begin() const { return Data; }
+    const T* end() const { return Data + Count; }
+    size_t size() const { return Count; }
+    const T& operator[](size_t Index) const { return Data[Index]; }
+};
+
+static constexpr uint32_t InvalidString = 0xFFFFFFFFu;
+
+class Index
+{
+public:
+    Index() = default;
+    Index(const Index&) = delete;
+    Index& operator=(const Index&) = delete;
+    ~Index() { Close(); }
+
+    // False with Error() set on I/O failure, a foreign or newer file, or a truncated one.
+    // Ids inside the columns are not checked here; call Verify for untrusted files.
+    bool Open(const char* FilePath)
+    {
+        Close();
+        if (!Map(FilePath))
+        {
+            return false;
+        }
+        if (!Validate())
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close()
+    {
+#if defined(_WIN32)
+        if (Base) UnmapViewOfFile(Base);
+        if (MappingHandle) CloseHandle(MappingHandle);
+        if (FileHandle != INVALID_HANDLE_VALUE) CloseHandle(FileHandle);
+        MappingHandle = nullptr;
+        FileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (Base) munmap(const_cast<uint8_t*>(Base), MappedSize);
+#endif
+        Base = nullptr;
+        MappedSize = 0;
+    }
+
+    // Full scan of every id and row reference; Open only checks the header and
+    // section bounds so that opening stays O(1) on large indexes
+    bool Verify()
+    {
+        const Header& H = GetHeader();
+        const Column<uint32_t> Offsets = StringOffsets();
+        const uint64_t DataSize = MappedSize - H.SectionOffsets[Section_StringData];
+        for (uint32_t Id = 0; Id < H.NumStrings; ++Id)
+        {
+            if (Offsets[Id] >= Offsets[Id + 1] || Offsets[Id + 1] > DataSize)
+            {
+                return Fail("project index string table is corrupt");
+            }
+        }
+        for (const Column<uint32_t>& Ids : { NodeType(), NodeName(), NodeGraph(), DepClass(), DepType(), DepGraph() })
+        {
+            for (const uint32_t Id : Ids)
+            {
+                if (Id >= H.NumStrings) return Fail("project index string id out of range");
+            }
+        }
+        for (const Column<uint32_t>& Rows : { ReachNode(), ReachEntry() })
+        {
+            for (const uint32_t Row : Rows)
+            {
+                if (Row >= H.NumNodes) return Fail("project index reach row out of range");
+            }
+        }
+        for (const BlueprintRecord& Record : Blueprints())
+        {
+            if (Record.Path >= H.NumStrings || Record.Name >= H.NumStrings || Record.Type >= H.NumStrings || Record.ParentClass >= H.NumStrings
+                || uint64_t(Record.FirstNode) + Record.NumNodes > H.NumNodes
+                || uint64_t(Record.FirstReach) + Record.NumReach > H.NumReach
+                || uint64_t(Record.FirstDependency) + Record.NumDependencies > H.NumDependencies)
+            {
+                return Fail("project index Blueprint record out of range");
+            }
+        }
+        return true;
+    }
+
+    const std::string& Error() const { return LastError; }
+    const Header& GetHeader() const { return *reinterpret_cast<const Header*>(Base); }
+    size_t GetFileSize() const { return MappedSize; }
+
+    Column<BlueprintRecord> Blueprints() const { return Get<BlueprintRecord>(Section_Blueprints, GetHeader().NumBlueprints); }
+    Column<uint32_t> NodeType() const { return Get<uint32_t>(Section_NodeType, GetHeader().NumNodes); }
+    Column<uint32_t> NodeName() const { return Get<uint32_t>(Section_NodeName, GetHeader().NumNodes); }
+    Column<uint32_t> NodeGraph() const { return Get<uint32_t>(Section_NodeGraph, GetHeader().NumNodes); }
+    Column<uint8_t> NodeFlags() const { return Get<uint8_t>(Section_NodeFlags, GetHeader().NumNodes); }
+    Column<uint32_t> ReachNode() const { return Get<uint32_t>(Section_ReachNode, GetHeader().NumReach); }
+    Column<uint32_t> ReachEntry() const { return Get<uint32_t>(Section_ReachEntry, GetHeader().NumReach); }
+    Column<uint32_t> DepClass() const { return Get<uint32_t>(Section_DepClass, GetHeader().NumDependencies); }
+    Column<uint32_t> DepType() const { return Get<uint32_t>(Section_DepType, GetHeader().NumDependencies); }
+    Column<uint32_t> DepGraph() const { return Get<uint32_t>(Section_DepGraph, GetHeader().NumDependencies); }
+
+    std::string_view String(uint32_t Id) const
+    {
+        const Column<uint32_t> Offsets = StringOffsets();
+        const char* Data = reinterpret_cast<const char*>(Base + GetHeader().SectionOffsets[Section_StringData]);
+        return std::string_view(Data + Offsets[Id], Offsets[Id + 1] - Offsets[Id] - 1);
+    }
+
+    // The table is sorted bytewise, so an exact lookup is a binary search
+    uint32_t FindString(std::string_view Value) const
+    {
+        uint32_t Low = 0;
+        uint32_t High = GetHeader().NumStrings;
+        while (Low < High)
+        {
+            const uint32_t Mid = Low + (High - Low) / 2;
+            if (String(Mid) < Value)
+            {
+                Low = Mid + 1;
+            }
+            else
+            {
+                High = Mid;
+            }
+        }
+        return Low < GetHeader().NumStrings && String(Low) == Value ? Low : InvalidString;
+    }
+
+    // Blueprint that owns a global node row
+    const BlueprintRecord* FindBlueprintForNode(uint32_t NodeRow) const
+    {
+        const Column<BlueprintRecord> Records = Blueprints();
+        size_t Low = 0;
+        size_t High = Records.size();
+        while (Low < High)
+        {
+            const size_t Mid = Low + (High - Low) / 2;
+            if (Records[Mid].FirstNode + Records[Mid].NumNodes <= NodeRow)
+            {
+                Low = Mid + 1;
+            }
+            else
+            {
+                High = Mid;
+            }
+        }
+        return Low < Records.size() && Records[Low].FirstNode <= NodeRow ? &Records[Low] : nullptr;
+    }
+
+private:
+    Column<uint32_t> StringOffsets() const { return Get<uint32_t>(Section_StringOffsets, GetHeader().NumStrings + 1); }
+
+    template<typename T>
+    Column<T> Get(Section Which, size_t Count) const
+    {
+        Column<T> Result;
+        Result.Data = reinterpret_cast<const T*>(Base + GetHeader().SectionOffsets[Which]);
+        Result.Count = Count;
+        return Result;
+    }
+
+    bool Fail(std::string Message)
+    {
+        LastError = std::move(Message);
+        return false;
+    }
+
+    bool Map(const char* FilePath)
+    {
+#if defined(_WIN32)
+        FileHandle = CreateFileA(FilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (FileHandle == INVALID_HANDLE_VALUE)
+        {
+            return Fail(std::string("cannot open ") + FilePath);
+        }
+        LARGE_INTEGER Size;
+        if (!GetFileSizeEx(FileHandle, &Size) || Size.QuadPart < (LONGLONG)sizeof(Header))
+        {
+            return Fail(std::string("not a project index: ") + FilePath);
+        }
+        MappingHandle = CreateFileMappingA(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        Base = MappingHandle ? static_cast<const uint8_t*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+        if (!Base)
+        {
+            return Fail(std::string("cannot map ") + FilePath);
+        }
+        MappedSize = static_cast<size_t>(Size.QuadPart);
+#else
+        const int Descriptor = open(FilePath, O_RDONLY);
+        if (Descriptor < 0)
+        {
+            return Fail(std::string("cannot open ") + FilePath);
+        }
+        struct stat Info;
+        if (fstat(Descriptor, &Info) != 0 || Info.st_size < (off_t)sizeof(Header))
+        {
+            close(Descriptor);
+            return Fail(std::string("not a project index: ") + FilePath);
+        }
+        void* Mapped = mmap(nullptr, static_cast<size_t>(Info.st_size), PROT_READ, MAP_PRIVATE, Descriptor, 0);
+        close(Descriptor);
+        if (Mapped == MAP_FAILED)
+        {
+            return Fail(std::string("cannot map ") + FilePath);
+        }
+        Base = static_cast<const uint8_t*>(Mapped);
+        MappedSize = static_cast<size_t>(Info.st_size);
+#endif
+        return true;
+    }
+
+    bool Validate()
+    {
+        const Header& H = GetHeader();
+        if (H.Magic != Header::MagicValue)
+        {
+            return Fail("not a project index (bad magic)");
+        }
+        if (H.Version != Header::CurrentVersion)
+        {
+            return Fail("unsupported project index version " + std::to_string(H.Version));
+        }
+        if (H.FileSize != MappedSize)
+        {
+            return Fail("project index is truncated");
+        }
+
+        const uint64_t Counts[Section_Num] = {
+            uint64_t(H.NumBlueprints) * sizeof(BlueprintRecord),
+            uint64_t(H.NumNodes) * 4, uint64_t(H.NumNodes) * 4, uint64_t(H.NumNodes) * 4, uint64_t(H.NumNodes),
+            uint64_t(H.NumReach) * 4, uint64_t(H.NumReach) * 4,
+            uint64_t(H.NumDependencies) * 4, uint64_t(H.NumDependencies) * 4, uint64_t(H.NumDependencies) * 4,
+            (uint64_t(H.NumStrings) + 1) * 4, 0,
+        };
+        for (uint32_t Which = 0; Which < Section_Num; ++Which)
+        {
+            if (H.SectionOffsets[Which] % 8 != 0 || H.SectionOffsets[Which] > MappedSize || Counts[Which] > MappedSize - H.SectionOffsets[Which])
+            {
+                return Fail("project index section " + std::to_string(Which) + " is out of bounds");
+            }
+        }
+
+        const uint64_t DataSize = MappedSize - H.SectionOffsets[Section_StringData];
+        if (StringOffsets()[H.NumStrings] > DataSize)
+        {
+            return Fail("project index string table is out of bounds");
+        }
+        return true;
+    }
+
+    const uint8_t* Base = nullptr;
+    size_t MappedSize = 0;
+    std::string LastError;
+#if defined(_WIN32)
+    HANDLE FileHandle = INVALID_HANDLE_VALUE;
+    HANDLE MappingHandle = nullptr;
+#endif
+};
+
+} // namespace bpindex
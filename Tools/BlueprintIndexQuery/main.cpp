@@ -0,0 +1,246 @@
+// Copyright (c) 2025 keemminxu. All Rights Reserved.
+
+// ============================================================
+// BlueprintIndexQuery
+// Answers questions about a project from the .bpidx written by
+// `-run=BlueprintAnalyzer -Index`, without starting the editor.
+// ============================================================
+
+#include "BlueprintIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+using namespace bpindex;
+
+static bool ContainsIgnoreCase(std::string_view Haystack, std::string_view Needle)
+{
+    const auto It = std::search(Haystack.begin(), Haystack.end(), Needle.begin(), Needle.end(),
+        [](char A, char B) { return std::tolower((unsigned char)A) == std::tolower((unsigned char)B); });
+    return It != Haystack.end();
+}
+
+static void PrintString(std::string_view Value)
+{
+    std::fwrite(Value.data(), 1, Value.size(), stdout);
+}
+
+static int PrintUsage()
+{
+    std::fprintf(stderr,
+        "usage: BlueprintIndexQuery <index.bpidx> <command>\n"
+        "  stats                                  counts and file size\n"
+        "  verify                                 check every id in the file\n"
+        "  blueprint <Name>                       summary of one Blueprint\n"
+        "  nodes <NodeType>                       Blueprints using a node class, e.g. K2Node_DynamicCast\n"
+        "  calls <Function> [--from <Entry>]      call sites; --from keeps those reachable from entries\n"
+        "                                         whose name contains <Entry>, e.g. --from Tick\n"
+        "  deps <Class>                           Blueprints that depend on a class\n");
+    return 2;
+}
+
+static int Stats(const Index& Idx)
+{
+    const Header& H = Idx.GetHeader();
+    std::printf("Blueprints:   %u\nNodes:        %u\nReach rows:   %u\nDependencies: %u\nStrings:      %u\nFile size:    %zu bytes\n",
+        H.NumBlueprints, H.NumNodes, H.NumReach, H.NumDependencies, H.NumStrings, Idx.GetFileSize());
+    return 0;
+}
+
+static int Blueprint(const Index& Idx, std::string_view Name)
+{
+    int Matches = 0;
+    for (const BlueprintRecord& Record : Idx.Blueprints())
+    {
+        if (Idx.String(Record.Name) != Name && Idx.String(Record.Path) != Name) continue;
+
+        ++Matches;
+        PrintString(Idx.String(Record.Path));
+        std::printf("\n  Type:        ");
+        PrintString(Idx.String(Record.Type));
+        std::printf("\n  Parent:      ");
+        PrintString(Idx.String(Record.ParentClass));
+        std::printf("\n  Nodes:       %u\n  Deps:        %u\n  Perf score:  %d\n  Tokens:      ~%d\n",
+            Record.NumNodes, Record.NumDependencies, Record.PerformanceScore, Record.EstimatedTokenCount);
+
+        std::printf("  Entries:\n");
+        const Column<uint8_t> Flags = Idx.NodeFlags();
+        for (uint32_t Row = Record.FirstNode; Row < Record.FirstNode + Record.NumNodes; ++Row)
+        {
+            if (!(Flags[Row] & (Node_Event | Node_FunctionEntry))) continue;
+            std::printf("    ");
+            PrintString(Idx.String(Idx.NodeName()[Row]));
+            std::printf(" [");
+            PrintString(Idx.String(Idx.NodeGraph()[Row]));
+            std::printf("]\n");
+        }
+    }
+    return Matches > 0 ? 0 : 1;
+}
+
+static int Nodes(const Index& Idx, std::string_view NodeType)
+{
+    const uint32_t TypeId = Idx.FindString(NodeType);
+    if (TypeId == InvalidString) return 1;
+
+    const Column<uint32_t> Types = Idx.NodeType();
+    int Matches = 0;
+    for (const BlueprintRecord& Record : Idx.Blueprints())
+    {
+        uint32_t Count = 0;
+        for (uint32_t Row = Record.FirstNode; Row < Record.FirstNode + Record.NumNodes; ++Row)
+        {
+            Count += Types[Row] == TypeId;
+        }
+        if (Count == 0) continue;
+
+        ++Matches;
+        std::printf("%6u  ", Count);
+        PrintString(Idx.String(Record.Path));
+        std::printf("\n");
+    }
+    return Matches > 0 ? 0 : 1;
+}
+
+static int Calls(const Index& Idx, std::string_view Function, std::string_view From)
+{
+    const uint32_t FunctionId = Idx.FindString(Function);
+    if (FunctionId == InvalidString) return 1;
+
+    const Column<uint32_t> Names = Idx.NodeName();
+    const Column<uint32_t> Graphs = Idx.NodeGraph();
+    int Matches = 0;
+
+    if (From.empty())
+    {
+        for (uint32_t Row = 0; Row < Names.size(); ++Row)
+        {
+            if (Names[Row] != FunctionId) continue;
+
+            ++Matches;
+            PrintString(Idx.String(Idx.FindBlueprintForNode(Row)->Path));
+            std::printf("  [");
+            PrintString(Idx.String(Graphs[Row]));
+            std::printf("]\n");
+        }
+        return Matches > 0 ? 0 : 1;
+    }
+
+    // Reach rows are per Blueprint, so walk them record by record and report each
+    // (call site, entry) pair once even when several paths lead there
+    const Column<uint32_t> ReachNode = Idx.ReachNode();
+    const Column<uint32_t> ReachEntry = Idx.ReachEntry();
+    std::vector<std::pair<uint32_t, uint32_t>> Hits;
+    for (const BlueprintRecord& Record : Idx.Blueprints())
+    {
+        Hits.clear();
+        for (uint32_t Row = Record.FirstReach; Row < Record.FirstReach + Record.NumReach; ++Row)
+        {
+            if (Names[ReachNode[Row]] == FunctionId && ContainsIgnoreCase(Idx.String(Names[ReachEntry[Row]]), From))
+            {
+                Hits.emplace_back(ReachNode[Row], ReachEntry[Row]);
+            }
+        }
+        std::sort(Hits.begin(), Hits.end());
+        Hits.erase(std::unique(Hits.begin(), Hits.end()), Hits.end());
+
+        for (const auto& [Node, Entry] : Hits)
+        {
+            ++Matches;
+            PrintString(Idx.String(Record.Path));
+            std::printf("  [");
+            PrintString(Idx.String(Graphs[Node]));
+            std::printf("]  from ");
+            PrintString(Idx.String(Names[Entry]));
+            std::printf("\n");
+        }
+    }
+    return Matches > 0 ? 0 : 1;
+}
+
+static int Deps(const Index& Idx, std::string_view Class)
+{
+    const uint32_t ClassId = Idx.FindString(Class);
+    if (ClassId == InvalidString) return 1;
+
+    const Column<uint32_t> Classes = Idx.DepClass();
+    const Column<uint32_t> Types = Idx.DepType();
+    const Column<uint32_t> Graphs = Idx.DepGraph();
+    int Matches = 0;
+    for (const BlueprintRecord& Record : Idx.Blueprints())
+    {
+        for (uint32_t Row = Record.FirstDependency; Row < Record.FirstDependency + Record.NumDependencies; ++Row)
+        {
+            if (Classes[Row] != ClassId) continue;
+
+            ++Matches;
+            PrintString(Idx.String(Record.Path));
+            std::printf("  ");
+            PrintString(Idx.String(Types[Row]));
+            std::printf("  [");
+            PrintString(Idx.String(Graphs[Row]));
+            std::printf("]\n");
+        }
+    }
+    return Matches > 0 ? 0 : 1;
+}
+
+int main(int Argc, char** Argv)
+{
+    if (Argc < 3) return PrintUsage();
+
+    const auto Start = std::chrono::steady_clock::now();
+
+    Index Idx;
+    if (!Idx.Open(Argv[1]))
+    {
+        std::fprintf(stderr, "%s\n", Idx.Error().c_str());
+        return 2;
+    }
+
+    const std::string_view Command = Argv[2];
+    const std::string_view Argument = Argc > 3 ? Argv[3] : "";
+    int Result = 0;
+    if (Command == "stats")
+    {
+        Result = Stats(Idx);
+    }
+    else if (Command == "verify")
+    {
+        Result = Idx.Verify() ? 0 : 1;
+        std::printf("%s\n", Result == 0 ? "ok" : Idx.Error().c_str());
+    }
+    else if (Argc < 4)
+    {
+        return PrintUsage();
+    }
+    else if (Command == "blueprint")
+    {
+        Result = Blueprint(Idx, Argument);
+    }
+    else if (Command == "nodes")
+    {
+        Result = Nodes(Idx, Argument);
+    }
+    else if (Command == "calls")
+    {
+        const bool bHasFrom = Argc > 5 && std::string_view(Argv[4]) == "--from";
+        Result = Calls(Idx, Argument, bHasFrom ? Argv[5] : "");
+    }
+    else if (Command == "deps")
+    {
+        Result = Deps(Idx, Argument);
+    }
+    else
+    {
+        return PrintUsage();
+    }
+
+    const double Elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    std::fprintf(stderr, "%s(%.2f ms)\n", Result == 1 && Command != "verify" ? "no matches " : "", Elapsed);
+    return Result;
+}